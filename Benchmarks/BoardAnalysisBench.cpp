@@ -0,0 +1,62 @@
+// Measures batch 3BV analysis throughput, checks the results do not depend on
+// the thread count and prints the 3BV spread of the batch.
+// usage: BoardAnalysisBench [width] [height] [mines] [boards] [max threads] [seed]
+#include "BoardAnalysis.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 30;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 16;
+	const int nMines = argc > 3 ? std::atoi(argv[3]) : 99;
+	const int nBoards = argc > 4 ? std::atoi(argv[4]) : 1000000;
+	const int maxThreads = argc > 5 ? std::atoi(argv[5]) : int(std::max(1u, std::thread::hardware_concurrency()));
+	const uint64_t seed = argc > 6 ? std::strtoull(argv[6], nullptr, 10) : 2016u;
+	const Vei2 safePos = { width / 2, height / 2 };
+
+	std::printf("board %dx%d, %d mines, %d boards from seed %llu, start (%d, %d)\n", width, height, nMines, nBoards,
+		(unsigned long long)seed, safePos.x, safePos.y);
+	std::printf("threads   boards/s\n");
+	std::vector<BoardAnalysis::Stats> baseline;
+	for (int nThreads = 1; nThreads <= maxThreads; nThreads *= 2)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const std::vector<BoardAnalysis::Stats> stats = BoardAnalysis::AnalyzeSeeds(nBoards, width, height, nMines,
+			safePos, seed, nThreads);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::printf("%7d %10.0f\n", nThreads, nBoards / seconds);
+		if (nThreads == 1)
+		{
+			baseline = stats;
+			continue;
+		}
+		for (int i = 0; i < nBoards; i++)
+		{
+			if (stats[i].bbbv != baseline[i].bbbv || stats[i].largestOpening != baseline[i].largestOpening)
+			{
+				std::printf("board %d differs from the single-threaded run\n", i);
+				return 1;
+			}
+		}
+	}
+	if (baseline.empty()) return 0;
+
+	std::vector<int> bbbvs;
+	double nOpenings = 0.0;
+	double nIslands = 0.0;
+	for (const BoardAnalysis::Stats& stats : baseline)
+	{
+		bbbvs.push_back(stats.bbbv);
+		nOpenings += stats.nOpenings;
+		nIslands += stats.nIslands;
+	}
+	std::sort(bbbvs.begin(), bbbvs.end());
+	std::printf("3BV: min %d  p10 %d  median %d  p90 %d  max %d\n", bbbvs.front(), bbbvs[bbbvs.size() / 10],
+		bbbvs[bbbvs.size() / 2], bbbvs[bbbvs.size() * 9 / 10], bbbvs.back());
+	std::printf("mean openings %.2f, mean islands %.2f\n", nOpenings / nBoards, nIslands / nBoards);
+	return 0;
+}
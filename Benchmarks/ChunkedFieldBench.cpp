@@ -0,0 +1,152 @@
+// Checks ChunkedMineField against a flat board and reports how fast chunks
+// are generated. The neighbour count of every tile in a square of chunks
+// must match a plain 3x3 count over the same mines laid out flat. That holds
+// along chunk borders too, whether the neighbouring chunk was loaded first
+// or generated on the side. A chunk must also come back identical after it
+// is evicted and reloaded, and chunks with a flag must never be evicted.
+// usage: ChunkedFieldBench [mines per chunk] [chunks per side] [seed]
+#include "BitGrid.h"
+#include "ChunkedMineField.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static constexpr int chunkSize = ChunkedMineField::chunkSize;
+
+// neighbour counts of the tiles in the square of nChunks x nChunks chunks
+// whose top left tile is origin, compared with a flat copy of the mines one
+// tile wider on every side
+static bool CheckAgainstFlat(ChunkedMineField& field, const Vei2& origin, int nChunks, const char* order)
+{
+	const int size = nChunks * chunkSize;
+	BitGrid flat(size + 2, size + 2);
+	for (int y = 0; y < size + 2; y++)
+	{
+		for (int x = 0; x < size + 2; x++)
+		{
+			if (field.HasMine(origin + Vei2(x - 1, y - 1)))
+			{
+				flat.Set(x, y);
+			}
+		}
+	}
+	for (int y = 1; y <= size; y++)
+	{
+		for (int x = 1; x <= size; x++)
+		{
+			int count = 0;
+			for (int dy = -1; dy <= 1; dy++)
+			{
+				for (int dx = -1; dx <= 1; dx++)
+				{
+					count += (dx != 0 || dy != 0) && flat.Get(x + dx, y + dy) ? 1 : 0;
+				}
+			}
+			const Vei2 gridPos = origin + Vei2(x - 1, y - 1);
+			if (!flat.Get(x, y) && field.GetNeighbourMineCount(gridPos) != count)
+			{
+				std::printf("%s: tile %d,%d has %d neighbour mines, the flat board %d\n", order, gridPos.x, gridPos.y,
+					field.GetNeighbourMineCount(gridPos), count);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+struct ChunkSnapshot
+{
+	std::vector<bool> mines;
+	std::vector<int> neighbourCounts;
+};
+
+static ChunkSnapshot TakeSnapshot(ChunkedMineField& field, const Vei2& chunkOrigin)
+{
+	ChunkSnapshot snapshot;
+	for (int y = 0; y < chunkSize; y++)
+	{
+		for (int x = 0; x < chunkSize; x++)
+		{
+			snapshot.mines.push_back(field.HasMine(chunkOrigin + Vei2(x, y)));
+			snapshot.neighbourCounts.push_back(field.GetNeighbourMineCount(chunkOrigin + Vei2(x, y)));
+		}
+	}
+	return snapshot;
+}
+
+int main(int argc, char** argv)
+{
+	const int nMinesPerChunk = argc > 1 ? std::atoi(argv[1]) : 640;
+	const int nChunks = argc > 2 ? std::atoi(argv[2]) : 6;
+	const uint64_t seed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 77;
+	// a square around the origin, so negative chunk coordinates are covered
+	const Vei2 origin = Vei2(-nChunks / 2, -nChunks / 2) * chunkSize;
+
+	std::printf("%dx%d chunks of %dx%d, %d mines each (%.1f%%)\n", nChunks, nChunks, chunkSize, chunkSize,
+		nMinesPerChunk, 100.0 * nMinesPerChunk / (chunkSize * chunkSize));
+
+	// in scan order most chunks are first counted with some neighbours loaded
+	// and others generated on the side
+	ChunkedMineField scanField(nMinesPerChunk, seed);
+	if (!CheckAgainstFlat(scanField, origin, nChunks, "scan order"))
+	{
+		return 1;
+	}
+	// loading every other chunk first, then the rest, gives the two extremes:
+	// no neighbour loaded, and all of them loaded
+	ChunkedMineField checkerField(nMinesPerChunk, seed);
+	for (int parity = 0; parity < 2; parity++)
+	{
+		for (int cy = -1; cy <= nChunks; cy++)
+		{
+			for (int cx = -1; cx <= nChunks; cx++)
+			{
+				if (((cx + cy) & 1) == parity)
+				{
+					checkerField.HasMine(origin + Vei2(cx, cy) * chunkSize);
+				}
+			}
+		}
+	}
+	if (!CheckAgainstFlat(checkerField, origin, nChunks, "checkerboard order"))
+	{
+		return 1;
+	}
+
+	// a flagged chunk stays, a far untouched chunk is dropped and comes back
+	// the same
+	const Vei2 farChunk = origin + Vei2(nChunks - 1, nChunks - 1) * chunkSize;
+	scanField.OnFlagClick(origin);
+	const ChunkSnapshot before = TakeSnapshot(scanField, farChunk);
+	const int nLoaded = scanField.GetLoadedChunkCount();
+	const int nEvicted = scanField.EvictUntouchedChunks(origin, 0);
+	if (!scanField.IsFlagged(origin) || nEvicted == 0 || scanField.GetLoadedChunkCount() != nLoaded - nEvicted)
+	{
+		std::printf("eviction dropped %d of %d chunks, the flagged one %s\n", nEvicted, nLoaded,
+			scanField.IsFlagged(origin) ? "kept" : "lost");
+		return 1;
+	}
+	const ChunkSnapshot after = TakeSnapshot(scanField, farChunk);
+	if (before.mines != after.mines || before.neighbourCounts != after.neighbourCounts)
+	{
+		std::printf("chunk at %d,%d differs after eviction and reload\n", farChunk.x, farChunk.y);
+		return 1;
+	}
+	std::printf("neighbour counts match the flat board; eviction dropped %d of %d chunks and reloaded one intact\n",
+		nEvicted, nLoaded);
+
+	// generation along a diagonal walk, each chunk with three of its
+	// neighbours unloaded
+	const int nWalkChunks = 2000;
+	ChunkedMineField walkField(nMinesPerChunk, seed);
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < nWalkChunks; i++)
+	{
+		walkField.HasMine(Vei2(i, i) * chunkSize);
+	}
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::printf("generation: %.0f chunks/s (%.1f us each), %.1f KB per loaded chunk\n", nWalkChunks / seconds,
+		seconds * 1e6 / nWalkChunks, walkField.GetMemoryBytes() / 1024.0 / walkField.GetLoadedChunkCount());
+	return 0;
+}
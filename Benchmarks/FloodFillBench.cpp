@@ -0,0 +1,68 @@
+// Opens every zero region of a large board and reports how fast the
+// scanline fill (or, with [indexed] = 1, the precomputed OpeningIndex)
+// reveals tiles, and the slowest single click.
+// usage: FloodFillBench [width] [height] [mine density] [boards] [indexed]
+#include "MineField.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 4096;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 4096;
+	const double density = argc > 3 ? std::atof(argv[3]) : 0.05;
+	const int nBoards = argc > 4 ? std::atoi(argv[4]) : 3;
+	const bool isIndexed = argc > 5 && std::atoi(argv[5]) != 0;
+	const int nMines = int(double(width) * height * density);
+
+	std::printf("board %dx%d, %d mines (%.1f%%), %d boards, %s\n", width, height, nMines, density * 100.0, nBoards,
+		isIndexed ? "opening index" : "scanline fill");
+
+	long long totalRevealed = 0;
+	long long totalOpenings = 0;
+	double totalSeconds = 0.0;
+	double maxClickSeconds = 0.0;
+	size_t memoryBytes = 0;
+	for (int i = 0; i < nBoards; i++)
+	{
+		MineField field(width, height, nMines, 1000u + i);
+		if (isIndexed)
+		{
+			field.EnableOpeningIndex();
+		}
+		field.Generate({ width / 2, height / 2 });
+		memoryBytes = field.GetMemoryBytes();
+
+		// clicking every closed zero in scan order opens each region exactly once;
+		// the scan itself is not timed, only the reveal calls
+		std::chrono::steady_clock::duration elapsed{};
+		for (Vei2 gridPos = { 0,0 }; gridPos.y < height; gridPos.y++)
+		{
+			for (gridPos.x = 0; gridPos.x < width; gridPos.x++)
+			{
+				const MineField::Tile tile = field.TileAt(gridPos);
+				if (tile.IsHidden() && !tile.HasMine() && tile.GetNeighbourMineCount() == 0)
+				{
+					const auto start = std::chrono::steady_clock::now();
+					field.OnRevealClick(gridPos);
+					const auto clickElapsed = std::chrono::steady_clock::now() - start;
+					elapsed += clickElapsed;
+					maxClickSeconds = std::max(maxClickSeconds, std::chrono::duration<double>(clickElapsed).count());
+					totalOpenings++;
+				}
+			}
+		}
+		totalRevealed += field.CountRevealed();
+		totalSeconds += std::chrono::duration<double>(elapsed).count();
+	}
+
+	std::printf("openings:        %lld\n", totalOpenings);
+	std::printf("tiles revealed:  %lld\n", totalRevealed);
+	std::printf("reveal time:     %.3f s\n", totalSeconds);
+	std::printf("tiles/sec:       %.3e\n", double(totalRevealed) / totalSeconds);
+	std::printf("slowest click:   %.3f ms\n", maxClickSeconds * 1000.0);
+	std::printf("board memory:    %.1f MB\n", double(memoryBytes) / (1024.0 * 1024.0));
+	return 0;
+}
@@ -0,0 +1,179 @@
+// Times FrontierEnumerator on the frontier components a deterministic solver
+// gets stuck on. Each game is played by MineSolver; whenever it is stuck every
+// component of at least [min cells] is enumerated, then a random safe tile is
+// revealed (the benchmark can see the mines) so the game goes on. Components
+// small enough to brute-force are checked against every subset of their
+// cells: solutions per mine total and per cell must match exactly.
+// usage: FrontierEnumBench [width] [height] [mines] [games] [threads] [min cells] [seed]
+#include "BitGrid.h"
+#include "CounterRng.h"
+#include "FrontierEnumerator.h"
+#include "MineField.h"
+#include "MineSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// components up to this size are checked against brute force
+static constexpr int maxCheckedCells = 16;
+
+// every subset of the cells with at most maxMines mines that satisfies all
+// the numbers, tallied like FrontierEnumerator; false with a message on the
+// first count that differs
+static bool MatchesBruteForce(const FrontierEnumerator::Component& component, int maxMines,
+	const FrontierEnumerator& enumerator)
+{
+	const int nCells = int(component.cells.size());
+	std::vector<uint32_t> masks;
+	for (const FrontierEnumerator::Constraint& constraint : component.constraints)
+	{
+		uint32_t mask = 0;
+		for (int cell : constraint.cells)
+		{
+			mask |= 1u << cell;
+		}
+		masks.push_back(mask);
+	}
+	std::vector<double> histogram(nCells + 1, 0.0);
+	std::vector<double> cellCounts(size_t(nCells + 1) * nCells, 0.0);
+	for (uint32_t mines = 0; mines < (1u << nCells); mines++)
+	{
+		const int nMines = BitGrid::Popcount(mines);
+		if (nMines > maxMines) continue;
+		bool isSolution = true;
+		for (size_t i = 0; i < masks.size() && isSolution; i++)
+		{
+			isSolution = BitGrid::Popcount(mines & masks[i]) == component.constraints[i].nMines;
+		}
+		if (!isSolution) continue;
+		histogram[nMines] += 1.0;
+		for (int cell = 0; cell < nCells; cell++)
+		{
+			cellCounts[size_t(nMines) * nCells + cell] += (mines >> cell) & 1u;
+		}
+	}
+	for (int k = 0; k <= std::min(nCells, maxMines); k++)
+	{
+		const double nSolutions = k < int(enumerator.GetHistogram().size()) ? enumerator.GetHistogram()[k] : 0.0;
+		if (nSolutions != histogram[k])
+		{
+			std::printf("%d-cell component: %.0f solutions with %d mines, brute force %.0f\n", nCells, nSolutions, k,
+				histogram[k]);
+			return false;
+		}
+		for (int cell = 0; cell < nCells; cell++)
+		{
+			const double nMineSolutions = nSolutions > 0.0 ? enumerator.GetMineCount(cell, k) : 0.0;
+			if (nMineSolutions != cellCounts[size_t(k) * nCells + cell])
+			{
+				std::printf("%d-cell component: cell %d mined in %.0f of the %d-mine solutions, brute force %.0f\n",
+					nCells, cell, nMineSolutions, k, cellCounts[size_t(k) * nCells + cell]);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 30;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 16;
+	const int nMines = argc > 3 ? std::atoi(argv[3]) : 99;
+	const int nGames = argc > 4 ? std::atoi(argv[4]) : 200;
+	const int nThreads = argc > 5 ? std::atoi(argv[5]) : 0;
+	const int minCells = argc > 6 ? std::atoi(argv[6]) : 40;
+	const uint64_t seed = argc > 7 ? std::strtoull(argv[7], nullptr, 10) : 2016u;
+
+	std::printf("board %dx%d, %d mines, %d games, components of %d+ cells, %d threads (0 = all)\n", width, height,
+		nMines, nGames, minCells, nThreads);
+	struct Sample
+	{
+		int nCells;
+		double nSolutions;
+		double seconds;
+	};
+	std::vector<Sample> samples;
+	int nChecked = 0;
+	CounterRng rng(seed, 2);
+	for (int game = 0; game < nGames; game++)
+	{
+		MineField field(width, height, nMines, seed + game, 1);
+		MineSolver solver(field);
+		field.OnRevealClick({ width / 2, height / 2 });
+		solver.Update(field.GetLastChangedRuns());
+		while (field.GetGameState() == MineField::GameState::Playing)
+		{
+			for (const Vei2& pos : solver.TakeMineTiles())
+			{
+				if (!field.TileAt(pos).IsHidden()) continue;
+				field.OnFlagClick(pos);
+				solver.Update(field.GetLastChangedRuns());
+			}
+			std::vector<Vei2> safeTiles = solver.TakeSafeTiles();
+			if (safeTiles.empty())
+			{
+				const int maxMines = nMines - int(field.CountFlagged());
+				for (const FrontierEnumerator::Component& component : FrontierEnumerator::FindComponents(field))
+				{
+					const int nCells = int(component.cells.size());
+					if (nCells <= maxCheckedCells)
+					{
+						const FrontierEnumerator enumerator(component, maxMines, nThreads);
+						if (!MatchesBruteForce(component, maxMines, enumerator))
+						{
+							return 1;
+						}
+						nChecked++;
+					}
+					if (nCells < minCells || nCells > FrontierEnumerator::maxCells) continue;
+					const auto start = std::chrono::steady_clock::now();
+					const FrontierEnumerator enumerator(component, maxMines, nThreads);
+					const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+					samples.push_back({ nCells, enumerator.GetSolutionCount(), seconds });
+				}
+				for (;;)
+				{
+					const Vei2 pos = { int(rng.UniformBelow(width)), int(rng.UniformBelow(height)) };
+					if (field.TileAt(pos).IsHidden() && !field.TileAt(pos).HasMine())
+					{
+						safeTiles.push_back(pos);
+						break;
+					}
+				}
+			}
+			for (const Vei2& pos : safeTiles)
+			{
+				if (!field.TileAt(pos).IsHidden()) continue;
+				field.OnRevealClick(pos);
+				solver.Update(field.GetLastChangedRuns());
+			}
+		}
+	}
+
+	std::printf("%d components of up to %d cells match brute force\n", nChecked, maxCheckedCells);
+	if (samples.empty())
+	{
+		std::printf("no component reached %d cells\n", minCells);
+		return 0;
+	}
+	std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b)
+	{
+		return a.seconds < b.seconds;
+	});
+	double totalSeconds = 0.0;
+	int maxCells = 0;
+	for (const Sample& sample : samples)
+	{
+		totalSeconds += sample.seconds;
+		maxCells = std::max(maxCells, sample.nCells);
+	}
+	const Sample& worst = samples.back();
+	std::printf("%zu components, largest %d cells\n", samples.size(), maxCells);
+	std::printf("ms: mean %.3f  p50 %.3f  p99 %.3f  max %.3f (%d cells, %.3g solutions)\n",
+		1000.0 * totalSeconds / samples.size(), 1000.0 * samples[samples.size() / 2].seconds,
+		1000.0 * samples[samples.size() * 99 / 100].seconds, 1000.0 * worst.seconds, worst.nCells, worst.nSolutions);
+	return 0;
+}
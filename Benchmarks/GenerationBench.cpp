@@ -0,0 +1,71 @@
+// Times board generation (mine placement + neighbour counts) from 1 to N
+// threads and checks every thread count produces the identical board.
+// usage: GenerationBench [width] [height] [mine density] [max threads] [seed]
+#include "BitGrid.h"
+#include "NibbleGrid.h"
+#include "MinePlacement.h"
+#include "NeighbourCountKernel.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+// FNV-1a over the row words
+template<typename Grid>
+static uint64_t HashRows(const Grid& grid, int height, uint64_t hash)
+{
+	for (int y = 0; y < height; y++)
+	{
+		const uint64_t* row = grid.Row(y);
+		for (int i = 0; i < grid.GetWordsPerRow(); i++)
+		{
+			hash = (hash ^ row[i]) * 0x100000001B3ull;
+		}
+	}
+	return hash;
+}
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 16384;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 16384;
+	const double density = argc > 3 ? std::atof(argv[3]) : 0.15;
+	const int maxThreads = argc > 4 ? std::atoi(argv[4]) : int(std::max(1u, std::thread::hardware_concurrency()));
+	const uint64_t seed = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : 2016u;
+	const int nMines = int(double(width) * height * density);
+
+	std::printf("board %dx%d (%.0f Mtiles), %d mines, seed %llu, band %d rows\n", width, height,
+		double(width) * height / 1e6, nMines, (unsigned long long)seed, MinePlacement::GetBandRows(width));
+	std::printf("threads   place ms   count ms   total ms   speedup   board hash\n");
+
+	double baseline = 0.0;
+	uint64_t baselineHash = 0;
+	for (int nThreads = 1; nThreads <= maxThreads; nThreads++)
+	{
+		BitGrid mines(width, height);
+		NibbleGrid counts(width, height);
+		const auto start = std::chrono::steady_clock::now();
+		MinePlacement::Place(mines, nMines, seed, nThreads);
+		const auto placed = std::chrono::steady_clock::now();
+		NeighbourCountKernel::Compute(mines, counts, NeighbourCountKernel::Path::Auto, nThreads);
+		const auto counted = std::chrono::steady_clock::now();
+
+		const double placeMs = std::chrono::duration<double, std::milli>(placed - start).count();
+		const double countMs = std::chrono::duration<double, std::milli>(counted - placed).count();
+		const double totalMs = placeMs + countMs;
+		const uint64_t hash = HashRows(counts, height, HashRows(mines, height, 0xCBF29CE484222325ull));
+		if (nThreads == 1)
+		{
+			baseline = totalMs;
+			baselineHash = hash;
+		}
+		std::printf("%7d %10.1f %10.1f %10.1f %8.2fx   %016llx\n", nThreads, placeMs, countMs, totalMs,
+			baseline / totalMs, (unsigned long long)hash);
+		if (mines.Count() != nMines || hash != baselineHash)
+		{
+			std::printf("board differs from the single-threaded one\n");
+			return 1;
+		}
+	}
+	return 0;
+}
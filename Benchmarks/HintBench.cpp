@@ -0,0 +1,65 @@
+// Plays one game by following MoveAdvisor hints and measures how long each
+// Suggest call takes against its budget. A hint that turns out to be a mine
+// is flagged instead, so the game goes on to the end or the move limit.
+// usage: HintBench [width] [height] [mines] [budget us] [max moves] [seed]
+#include "MineField.h"
+#include "MoveAdvisor.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 30;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 16;
+	const int nMines = argc > 3 ? std::atoi(argv[3]) : 99;
+	const int budgetUs = argc > 4 ? std::atoi(argv[4]) : 1000;
+	const int maxMoves = argc > 5 ? std::atoi(argv[5]) : 100000;
+	const uint64_t seed = argc > 6 ? std::strtoull(argv[6], nullptr, 10) : 2016u;
+	const std::chrono::microseconds budget(budgetUs);
+
+	std::printf("board %dx%d, %d mines, seed %llu, budget %d us\n", width, height, nMines, (unsigned long long)seed, budgetUs);
+	MineField field(width, height, nMines, seed);
+	MoveAdvisor advisor(field);
+	std::vector<double> latencies;
+	int nSources[5] = {};
+	int nMisses = 0;
+	while (field.GetGameState() == MineField::GameState::Playing && int(latencies.size()) < maxMoves)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const MoveAdvisor::Hint hint = advisor.Suggest(budget);
+		latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+		nSources[int(hint.source)]++;
+		if (hint.gridPos.x < 0) break;
+		if (field.IsGenerated() && field.TileAt(hint.gridPos).HasMine())
+		{
+			field.OnFlagClick(hint.gridPos);
+			nMisses++;
+		}
+		else
+		{
+			field.OnRevealClick(hint.gridPos);
+		}
+		advisor.Update(field.GetLastChangedRuns());
+	}
+	if (latencies.empty()) return 0;
+
+	const int nHints = int(latencies.size());
+	double total = 0.0;
+	int nOverBudget = 0;
+	for (double latency : latencies)
+	{
+		total += latency;
+		nOverBudget += latency > budgetUs ? 1 : 0;
+	}
+	std::sort(latencies.begin(), latencies.end());
+	std::printf("%d hints, %s, %d hinted mines flagged\n", nHints,
+		field.GetGameState() == MineField::GameState::Win ? "won" : "not finished", nMisses);
+	std::printf("latency us: mean %.1f  p50 %.1f  p99 %.1f  max %.1f, %d over budget\n", total / nHints,
+		latencies[nHints / 2], latencies[std::min(nHints - 1, nHints * 99 / 100)], latencies.back(), nOverBudget);
+	std::printf("first click %d, deduction %d, local estimate %d, exact %d, any tile %d\n", nSources[0], nSources[1],
+		nSources[2], nSources[3], nSources[4]);
+	return 0;
+}
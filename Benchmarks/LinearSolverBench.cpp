@@ -0,0 +1,222 @@
+// Compares LinearSolver with FrontierEnumerator where MineSolver's local rules
+// get stuck. Each game is played by MineSolver; whenever it is stuck the
+// benchmark counts the cells each method proves safe or mined and times it:
+// - the enumerator runs on every component of at most [max enum cells];
+// - a LinearSolver is built from scratch over the whole frontier.
+// Linear deductions are then played. If there are none, a random safe tile
+// is revealed, since the benchmark can see the mines. An incrementally
+// updated LinearSolver follows the whole game to time its per-move Update.
+// Components too wide to enumerate are where the linear system has to earn
+// its keep: on those, its forced cells are set against MineProbability's,
+// given [wide budget ms] per position to finish, or give up.
+// usage: LinearSolverBench [width] [height] [mines] [games] [max enum cells] [seed] [wide budget ms]
+#include "BitGrid.h"
+#include "CounterRng.h"
+#include "FrontierEnumerator.h"
+#include "LinearSolver.h"
+#include "MineField.h"
+#include "MineProbability.h"
+#include "MineSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 30;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 16;
+	const int nMines = argc > 3 ? std::atoi(argv[3]) : 99;
+	const int nGames = argc > 4 ? std::atoi(argv[4]) : 200;
+	const int maxEnumCells = argc > 5 ? std::atoi(argv[5]) : 64;
+	const uint64_t seed = argc > 6 ? std::strtoull(argv[6], nullptr, 10) : 2016u;
+	const double wideBudgetMs = argc > 7 ? std::atof(argv[7]) : 20.0;
+
+	std::printf("board %dx%d, %d mines, %d games, enumerating components of up to %d cells\n", width, height, nMines,
+		nGames, maxEnumCells);
+	using Clock = std::chrono::steady_clock;
+	long long nStuck = 0;
+	long long nEnumForced = 0;
+	long long nEnumSkipped = 0;
+	long long maxComponentCells = 0;
+	long long nLinearForced = 0;
+	long long nWrong = 0;
+	long long nUpdates = 0;
+	double enumSeconds = 0.0;
+	double linearSeconds = 0.0;
+	double updateSeconds = 0.0;
+	double maxUpdateSeconds = 0.0;
+	long long nDroppedRows = 0;
+	// positions with a component too wide to enumerate, split by whether the
+	// exact probabilities finished in time, and what each method forces on
+	// the cells of those components
+	long long nWidePositions = 0;
+	long long nWideExactTimedOut = 0;
+	long long nWideLinearForced = 0;
+	long long nWideExactForced = 0;
+	long long nTimedOutLinearForced = 0;
+	double wideLinearSeconds = 0.0;
+	double wideExactSeconds = 0.0;
+	CounterRng rng(seed, 3);
+	for (int game = 0; game < nGames; game++)
+	{
+		MineField field(width, height, nMines, seed + game, 1);
+		MineSolver solver(field);
+		LinearSolver incremental(field);
+		std::vector<Vei2> safeTiles;
+		std::vector<Vei2> mineTiles;
+		auto click = [&](const Vei2& pos, bool isFlag)
+		{
+			if (!field.TileAt(pos).IsHidden()) return;
+			if (isFlag)
+			{
+				field.OnFlagClick(pos);
+			}
+			else
+			{
+				field.OnRevealClick(pos);
+			}
+			solver.Update(field.GetLastChangedRuns());
+			const auto start = Clock::now();
+			incremental.Update(field.GetLastChangedRuns());
+			const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+			updateSeconds += seconds;
+			maxUpdateSeconds = std::max(maxUpdateSeconds, seconds);
+			nUpdates++;
+		};
+		click({ width / 2, height / 2 }, false);
+		while (field.GetGameState() == MineField::GameState::Playing)
+		{
+			for (const Vei2& pos : solver.TakeMineTiles())
+			{
+				mineTiles.push_back(pos);
+			}
+			for (const Vei2& pos : solver.TakeSafeTiles())
+			{
+				safeTiles.push_back(pos);
+			}
+			if (safeTiles.empty() && mineTiles.empty())
+			{
+				nStuck++;
+				const int maxMines = nMines - int(field.CountFlagged());
+				BitGrid wideCells(width, height);
+				bool hasWideComponent = false;
+				auto start = Clock::now();
+				for (const FrontierEnumerator::Component& component : FrontierEnumerator::FindComponents(field))
+				{
+					const int nCells = int(component.cells.size());
+					maxComponentCells = std::max<long long>(maxComponentCells, nCells);
+					if (nCells > maxEnumCells || nCells > FrontierEnumerator::maxCells)
+					{
+						nEnumSkipped++;
+						for (const Vei2& pos : component.cells)
+						{
+							wideCells.Set(pos.x, pos.y);
+						}
+						hasWideComponent = true;
+						continue;
+					}
+					const FrontierEnumerator enumerator(component, maxMines, 1);
+					for (int cell = 0; cell < nCells; cell++)
+					{
+						const double nMineSolutions = enumerator.GetMineCount(cell);
+						nEnumForced += nMineSolutions == 0.0 || nMineSolutions == enumerator.GetSolutionCount() ? 1 : 0;
+					}
+				}
+				enumSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+
+				start = Clock::now();
+				LinearSolver linear(field);
+				const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+				linearSeconds += seconds;
+				nDroppedRows += linear.GetDroppedRowCount();
+				long long nLinearWide = 0;
+				for (const Vei2& pos : linear.TakeSafeTiles())
+				{
+					nWrong += field.TileAt(pos).HasMine() ? 1 : 0;
+					nLinearWide += wideCells.Get(pos.x, pos.y) ? 1 : 0;
+					safeTiles.push_back(pos);
+				}
+				for (const Vei2& pos : linear.TakeMineTiles())
+				{
+					nWrong += field.TileAt(pos).HasMine() ? 0 : 1;
+					nLinearWide += wideCells.Get(pos.x, pos.y) ? 1 : 0;
+					mineTiles.push_back(pos);
+				}
+				if (hasWideComponent)
+				{
+					// the exact probabilities enumerate every component too, so
+					// on these positions they finish in time or not at all
+					nWidePositions++;
+					wideLinearSeconds += seconds;
+					start = Clock::now();
+					const MineProbability exact(field, start + std::chrono::duration_cast<Clock::duration>(
+						std::chrono::duration<double, std::milli>(wideBudgetMs)));
+					wideExactSeconds += std::chrono::duration<double>(Clock::now() - start).count();
+					if (!exact.IsComplete())
+					{
+						nWideExactTimedOut++;
+						nTimedOutLinearForced += nLinearWide;
+					}
+					else if (exact.IsConsistent())
+					{
+						nWideLinearForced += nLinearWide;
+						const std::vector<Vei2>& frontier = exact.GetFrontier();
+						const std::vector<double>& probabilities = exact.GetFrontierProbabilities();
+						for (size_t i = 0; i < frontier.size(); i++)
+						{
+							const bool isForced = probabilities[i] < 1e-9 || probabilities[i] > 1.0 - 1e-9;
+							nWideExactForced += isForced && wideCells.Get(frontier[i].x, frontier[i].y) ? 1 : 0;
+						}
+					}
+				}
+				nLinearForced += (long long)(safeTiles.size() + mineTiles.size());
+				if (safeTiles.empty() && mineTiles.empty())
+				{
+					for (;;)
+					{
+						const Vei2 pos = { int(rng.UniformBelow(width)), int(rng.UniformBelow(height)) };
+						if (field.TileAt(pos).IsHidden() && !field.TileAt(pos).HasMine())
+						{
+							safeTiles.push_back(pos);
+							break;
+						}
+					}
+				}
+			}
+			for (const Vei2& pos : mineTiles)
+			{
+				click(pos, true);
+			}
+			mineTiles.clear();
+			for (const Vei2& pos : safeTiles)
+			{
+				click(pos, false);
+			}
+			safeTiles.clear();
+		}
+		nDroppedRows += incremental.GetDroppedRowCount();
+	}
+
+	std::printf("%lld stuck positions, largest component %lld cells\n", nStuck, maxComponentCells);
+	std::printf("enumeration: %.3f s, %lld cells forced, %lld components too wide to enumerate\n", enumSeconds,
+		nEnumForced, nEnumSkipped);
+	std::printf("linear:      %.3f s, %lld cells forced over the whole frontier, %lld wrong, %lld rows dropped\n",
+		linearSeconds, nLinearForced, nWrong, nDroppedRows);
+	if (nWidePositions > 0)
+	{
+		std::printf("components too wide to enumerate at %lld positions: linear %.3f s, exact %.3f s (%.0f ms each)\n",
+			nWidePositions, wideLinearSeconds, wideExactSeconds, wideBudgetMs);
+		std::printf("  exact finished at %lld: %lld cells forced by linear, %lld by exact\n",
+			nWidePositions - nWideExactTimedOut, nWideLinearForced, nWideExactForced);
+		std::printf("  exact out of time at %lld: %lld cells forced by linear, none by exact\n", nWideExactTimedOut,
+			nTimedOutLinearForced);
+	}
+	if (nUpdates > 0)
+	{
+		std::printf("incremental update: mean %.2f us, max %.2f us over %lld moves\n", updateSeconds / nUpdates * 1e6,
+			maxUpdateSeconds * 1e6, nUpdates);
+	}
+	return nWrong == 0 ? 0 : 1;
+}
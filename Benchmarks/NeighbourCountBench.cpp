@@ -0,0 +1,130 @@
+// Checks the bulk neighbour-count kernel against the per-tile count and
+// times both.
+// usage: NeighbourCountBench [width] [height] [mine density]
+#include "BitGrid.h"
+#include "NibbleGrid.h"
+#include "NeighbourCountKernel.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+// same clamped 3x3 walk as MineField::CountNeighboursMines
+static int CountNeighboursMines(const BitGrid& mines, int x, int y)
+{
+	const int xStart = std::max(0, x - 1);
+	const int xEnd = std::min(mines.GetWidth() - 1, x + 1);
+	const int yStart = std::max(0, y - 1);
+	const int yEnd = std::min(mines.GetHeight() - 1, y + 1);
+	int mineCount = 0;
+	for (int nx = xStart; nx <= xEnd; nx++)
+	{
+		for (int ny = yStart; ny <= yEnd; ny++)
+		{
+			if (mines.Get(nx, ny))
+			{
+				mineCount++;
+			}
+		}
+	}
+	return mineCount;
+}
+
+static BitGrid MakeMines(int width, int height, double density, std::mt19937& rng)
+{
+	BitGrid mines(width, height);
+	std::bernoulli_distribution isMine(density);
+	for (int y = 0; y < height; y++)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			if (isMine(rng))
+			{
+				mines.Set(x, y);
+			}
+		}
+	}
+	return mines;
+}
+
+static bool Verify(const BitGrid& mines, NeighbourCountKernel::Path path)
+{
+	NibbleGrid counts(mines.GetWidth(), mines.GetHeight());
+	NeighbourCountKernel::Compute(mines, counts, path);
+	for (int y = 0; y < mines.GetHeight(); y++)
+	{
+		for (int x = 0; x < mines.GetWidth(); x++)
+		{
+			const int expected = CountNeighboursMines(mines, x, y) - (mines.Get(x, y) ? 1 : 0);
+			if (counts.Get(x, y) != expected)
+			{
+				std::printf("MISMATCH at (%d,%d) on %dx%d: %d != %d\n", x, y,
+					mines.GetWidth(), mines.GetHeight(), counts.Get(x, y), expected);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+template<typename F>
+static double TimeSeconds(F&& f)
+{
+	const auto start = std::chrono::steady_clock::now();
+	f();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 8192;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 8192;
+	const double density = argc > 3 ? std::atof(argv[3]) : 0.2;
+	const bool hasAvx2 = NeighbourCountKernel::IsAvx2Supported();
+	std::mt19937 rng(12345u);
+
+	// odd sizes exercise the word tails and single-row/column boards
+	const int sizes[][2] = { { 1,1 },{ 1,7 },{ 7,1 },{ 15,3 },{ 16,16 },{ 17,5 },{ 63,9 },{ 64,64 },
+		{ 65,33 },{ 100,77 },{ 129,2 },{ 300,200 } };
+	for (const auto& size : sizes)
+	{
+		for (double d : { 0.0,0.1,0.5,1.0 })
+		{
+			const BitGrid mines = MakeMines(size[0], size[1], d, rng);
+			if (!Verify(mines, NeighbourCountKernel::Path::Scalar) ||
+				(hasAvx2 && !Verify(mines, NeighbourCountKernel::Path::Avx2)))
+			{
+				return 1;
+			}
+		}
+	}
+	std::printf("kernel matches per-tile counts (scalar%s)\n", hasAvx2 ? " + AVX2" : "");
+
+	const BitGrid mines = MakeMines(width, height, density, rng);
+	const double nTiles = double(width) * height;
+	std::printf("board %dx%d at %.0f%% density\n", width, height, density * 100.0);
+
+	NibbleGrid counts(width, height);
+	const double perTile = TimeSeconds([&]()
+	{
+		for (int y = 0; y < height; y++)
+		{
+			for (int x = 0; x < width; x++)
+			{
+				counts.Set(x, y, CountNeighboursMines(mines, x, y));
+			}
+		}
+	});
+	std::printf("per-tile: %8.3f ms  %.3e tiles/s\n", perTile * 1e3, nTiles / perTile);
+
+	const double scalar = TimeSeconds([&]() { NeighbourCountKernel::Compute(mines, counts, NeighbourCountKernel::Path::Scalar); });
+	std::printf("scalar:   %8.3f ms  %.3e tiles/s\n", scalar * 1e3, nTiles / scalar);
+
+	if (hasAvx2)
+	{
+		const double avx2 = TimeSeconds([&]() { NeighbourCountKernel::Compute(mines, counts, NeighbourCountKernel::Path::Avx2); });
+		std::printf("avx2:     %8.3f ms  %.3e tiles/s\n", avx2 * 1e3, nTiles / avx2);
+	}
+	return 0;
+}
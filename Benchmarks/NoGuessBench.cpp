@@ -0,0 +1,56 @@
+// Measures no-guess board throughput and checks the accepted seeds do not
+// depend on the thread count.
+// usage: NoGuessBench [width] [height] [mines] [boards] [max threads] [seed]
+#include "NoGuessGenerator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 30;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 16;
+	const int nMines = argc > 3 ? std::atoi(argv[3]) : 99;
+	const int nBoards = argc > 4 ? std::atoi(argv[4]) : 200;
+	const int maxThreads = argc > 5 ? std::atoi(argv[5]) : int(std::max(1u, std::thread::hardware_concurrency()));
+	const uint64_t seed = argc > 6 ? std::strtoull(argv[6], nullptr, 10) : 2016u;
+	const Vei2 safePos = { width / 2, height / 2 };
+
+	std::printf("board %dx%d, %d mines, %d no-guess boards from seed %llu, start (%d, %d)\n", width, height, nMines,
+		nBoards, (unsigned long long)seed, safePos.x, safePos.y);
+	std::printf("threads   boards/s   acceptance\n");
+
+	std::vector<uint64_t> baseline;
+	for (int nThreads = 1; nThreads <= maxThreads; nThreads *= 2)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const std::vector<uint64_t> seeds = NoGuessGenerator::FindSeeds(nBoards, width, height, nMines, safePos, seed, nThreads);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		if (int(seeds.size()) < nBoards)
+		{
+			std::printf("gave up after %d of %d boards: %llu candidates in a row were not solvable\n", int(seeds.size()),
+				nBoards, (unsigned long long)NoGuessGenerator::defaultMaxAttempts);
+			return 1;
+		}
+		if (seeds.empty())
+		{
+			std::printf("%7d %10s %12s\n", nThreads, "-", "-");
+		}
+		else
+		{
+			const double nCandidates = double(seeds.back() - seed + 1);
+			std::printf("%7d %10.1f %11.1f%%\n", nThreads, nBoards / seconds, 100.0 * nBoards / nCandidates);
+		}
+		if (nThreads == 1)
+		{
+			baseline = seeds;
+		}
+		else if (seeds != baseline)
+		{
+			std::printf("seeds differ from the single-threaded run\n");
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,255 @@
+// Draws the board headless (Graphics without a window) and reports what a
+// frame costs: a full redraw of the field, the incremental frames of a game
+// played to the end through the view's clicks, an idle frame, SpriteCodex
+// tiles on their own and the BeginFrame clear. Every incremental frame is
+// checked against a full redraw of the same board, and so is every frame of
+// [check games] games of random reveals, flag toggles and hint highlights
+// (won, lost, or cut off after a few hundred moves). With a path the last frame is saved there (.ppm,
+// otherwise .bmp).
+// usage: RenderBench [width] [height] [mines] [frames] [check games] [frame dump path]
+#include "CounterRng.h"
+#include "Graphics.h"
+#include "MineField.h"
+#include "MineFieldView.h"
+#include "SpriteCodex.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static bool IsSameFrame(const Surface& a, const Surface& b)
+{
+	for (int y = 0; y < a.GetHeight(); y++)
+	{
+		if (std::memcmp(a.GetRow(y), b.GetRow(y), sizeof(Color) * a.GetWidth()) != 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Plays up to maxMoves random clicks and highlight moves, drawing a frame
+// after each and comparing it with a full redraw of the same view; a few more
+// moves follow the end of the game, which the view must ignore. False with a
+// message on the first frame that differs; state is how the game stands at
+// the end.
+static bool CheckRandomGame(int width, int height, int nMines, uint64_t seed, int maxMoves, Graphics& gfx,
+	Graphics& reference, MineField::GameState& state)
+{
+	const Vei2 center = { Graphics::ScreenWidth / 2, Graphics::ScreenHeight / 2 };
+	MineField field(width, height, nMines, seed);
+	MineFieldView view(field, center);
+	const RectI viewRect = view.GetRect();
+	CounterRng rng(seed, 4);
+	int nMovesAfterEnd = 8;
+	for (int step = 0; step < maxMoves && nMovesAfterEnd > 0; step++)
+	{
+		const Vei2 gridPos = { int(rng.UniformBelow(width)), int(rng.UniformBelow(height)) };
+		Vei2 screenPos = { viewRect.left + gridPos.x * SpriteCodex::tileSize + int(rng.UniformBelow(SpriteCodex::tileSize)),
+			viewRect.top + gridPos.y * SpriteCodex::tileSize + int(rng.UniformBelow(SpriteCodex::tileSize)) };
+		switch (rng.UniformBelow(8))
+		{
+		case 0:
+			view.SetHighlight(gridPos);
+			break;
+		case 1:
+			view.ClearHighlight();
+			break;
+		case 2:
+		case 3:
+			view.OnFlagClick(screenPos);
+			break;
+		default:
+			// now and then whatever is there, otherwise the next closed safe
+			// tile in scan order, so most games get somewhere before they end
+			if (field.IsGenerated() && rng.UniformBelow(128) != 0)
+			{
+				for (int i = 0; i < width * height; i++)
+				{
+					const Vei2 pos = { (gridPos.x + i) % width, (gridPos.y + (gridPos.x + i) / width) % height };
+					const MineField::Tile tile = field.TileAt(pos);
+					if (tile.IsHidden() && !tile.HasMine())
+					{
+						screenPos = screenPos + (pos - gridPos) * SpriteCodex::tileSize;
+						break;
+					}
+				}
+			}
+			view.OnRevealClick(screenPos);
+			break;
+		}
+		if (field.GetGameState() != MineField::GameState::Playing)
+		{
+			nMovesAfterEnd--;
+		}
+		// as in Game::Go; the reference is always a cleared frame, so whatever
+		// the last game left outside this board must be cleared too
+		if (view.IsFullRedrawPending())
+		{
+			gfx.BeginFrame();
+		}
+		view.Draw(gfx);
+		reference.BeginFrame();
+		view.Invalidate();
+		view.Draw(reference);
+		if (!IsSameFrame(gfx.GetFrame(), reference.GetFrame()))
+		{
+			std::printf("game %llu, move %d: frame differs from a full redraw\n", (unsigned long long)seed, step);
+			return false;
+		}
+	}
+	state = field.GetGameState();
+	return true;
+}
+
+template<typename F>
+static double MeasureMicroseconds(int nRuns, F&& f)
+{
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < nRuns; i++)
+	{
+		f(i);
+	}
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / nRuns;
+}
+
+int main(int argc, char** argv)
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 48;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 36;
+	const int nMines = argc > 3 ? std::atoi(argv[3]) : 300;
+	const int nFrames = argc > 4 ? std::atoi(argv[4]) : 2000;
+	const int nCheckGames = argc > 5 ? std::atoi(argv[5]) : 10;
+	const char* const dumpPath = argc > 6 ? argv[6] : nullptr;
+	const Vei2 center = { Graphics::ScreenWidth / 2, Graphics::ScreenHeight / 2 };
+
+	Graphics gfx;
+	Graphics reference;
+	MineField field(width, height, nMines, 1234u);
+	MineFieldView view(field, center);
+	const RectI viewRect = view.GetRect();
+	const auto toScreen = [&viewRect](int x, int y)
+	{
+		return Vei2{ viewRect.left + x * SpriteCodex::tileSize + SpriteCodex::tileSize / 2,
+			viewRect.top + y * SpriteCodex::tileSize + SpriteCodex::tileSize / 2 };
+	};
+	std::printf("board %dx%d, %d mines, %dx%d frame, %s\n", width, height, nMines,
+		Graphics::ScreenWidth, Graphics::ScreenHeight, gfx.IsHeadless() ? "headless" : "windowed");
+
+	// the first reveal places the mines; from there on every frame only has
+	// the tiles that click changed to draw
+	view.OnRevealClick(toScreen(width / 2, height / 2));
+	view.Draw(gfx);
+
+	const double fullMicroseconds = MeasureMicroseconds(nFrames, [&](int)
+	{
+		view.Invalidate();
+		view.Draw(gfx);
+	});
+	const double idleMicroseconds = MeasureMicroseconds(nFrames, [&](int)
+	{
+		view.Draw(gfx);
+	});
+
+	// reveal every safe tile in scan order and flag every mine, drawing a
+	// frame after each click; only the Draw calls are timed
+	std::chrono::steady_clock::duration playElapsed{};
+	int nPlayFrames = 0;
+	for (Vei2 gridPos = { 0,0 }; gridPos.y < height; gridPos.y++)
+	{
+		for (gridPos.x = 0; gridPos.x < width; gridPos.x++)
+		{
+			const MineField::Tile tile = field.TileAt(gridPos);
+			if (!tile.IsHidden() || field.GetGameState() != MineField::GameState::Playing)
+			{
+				continue;
+			}
+			if (tile.HasMine())
+			{
+				view.OnFlagClick(toScreen(gridPos.x, gridPos.y));
+			}
+			else
+			{
+				view.OnRevealClick(toScreen(gridPos.x, gridPos.y));
+			}
+			const auto start = std::chrono::steady_clock::now();
+			view.Draw(gfx);
+			playElapsed += std::chrono::steady_clock::now() - start;
+			nPlayFrames++;
+
+			view.Invalidate();
+			view.Draw(reference);
+			if (!IsSameFrame(gfx.GetFrame(), reference.GetFrame()))
+			{
+				std::printf("frame %d differs from a full redraw (tile %d,%d)\n", nPlayFrames, gridPos.x, gridPos.y);
+				return 1;
+			}
+		}
+	}
+	const bool isWon = field.GetGameState() == MineField::GameState::Win;
+
+	// each game starts on a frame the previous one left behind, as a new game
+	// does in the window
+	Graphics checkGfx;
+	int nCheckGamesIn[3] = {};
+	for (int game = 0; game < nCheckGames; game++)
+	{
+		MineField::GameState state;
+		if (!CheckRandomGame(width, height, nMines, 5000u + game, 400, checkGfx, reference, state))
+		{
+			return 1;
+		}
+		nCheckGamesIn[int(state)]++;
+	}
+
+	// every tile sprite, tiled over the whole screen
+	const int nColumns = Graphics::ScreenWidth / SpriteCodex::tileSize;
+	const int nRows = Graphics::ScreenHeight / SpriteCodex::tileSize;
+	const double screenOfTilesMicroseconds = MeasureMicroseconds(nFrames, [&](int i)
+	{
+		for (int y = 0; y < nRows; y++)
+		{
+			for (int x = 0; x < nColumns; x++)
+			{
+				const Vei2 pos = { x * SpriteCodex::tileSize,y * SpriteCodex::tileSize };
+				const int n = (x + y + i) % 10;
+				if (n < 9)
+				{
+					SpriteCodex::DrawTileNumber(pos, n, reference);
+				}
+				else
+				{
+					SpriteCodex::DrawTileButton(pos, reference);
+				}
+			}
+		}
+	});
+	const double clearMicroseconds = MeasureMicroseconds(nFrames, [&](int)
+	{
+		reference.BeginFrame();
+	});
+
+	std::printf("full redraw      %9.1f us/frame\n", fullMicroseconds);
+	std::printf("incremental      %9.1f us/frame (%d frames, game %s)\n",
+		std::chrono::duration<double, std::micro>(playElapsed).count() / std::max(nPlayFrames, 1), nPlayFrames,
+		isWon ? "won" : "not finished");
+	std::printf("idle             %9.1f us/frame\n", idleMicroseconds);
+	std::printf("random games     %d won, %d lost, %d cut off; every frame matches a full redraw\n",
+		nCheckGamesIn[int(MineField::GameState::Win)], nCheckGamesIn[int(MineField::GameState::Lose)],
+		nCheckGamesIn[int(MineField::GameState::Playing)]);
+	std::printf("sprite tiles     %9.1f Mtiles/s\n", nColumns * nRows / screenOfTilesMicroseconds);
+	std::printf("frame clear      %9.1f us/frame\n", clearMicroseconds);
+
+	if (dumpPath != nullptr)
+	{
+		if (!gfx.SaveFrame(dumpPath))
+		{
+			std::printf("could not write %s\n", dumpPath);
+			return 1;
+		}
+		std::printf("last frame saved to %s\n", dumpPath);
+	}
+	return 0;
+}
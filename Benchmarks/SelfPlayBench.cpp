@@ -0,0 +1,145 @@
+// Plays N games with a PlayStrategy through MineField's own reveal/flag
+// clicks on a work-stealing pool and reports throughput, win rate and the
+// per-move latency distribution (strategy decision + engine move).
+// usage: SelfPlayBench [strategy] [games] [width] [height] [mines] [threads] [seed]
+#include "MineField.h"
+#include "Parallel.h"
+#include "PlayStrategy.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// log-linear histogram: 16 sub-buckets per power of two nanoseconds, so
+// percentiles come out within ~6% without keeping every sample
+class LatencyHistogram
+{
+public:
+	void Add(long long ns)
+	{
+		counts[GetBucket(std::max(1ll, ns))]++;
+		nSamples++;
+	}
+	void Merge(const LatencyHistogram& other)
+	{
+		for (int i = 0; i < nBuckets; i++)
+		{
+			counts[i] += other.counts[i];
+		}
+		nSamples += other.nSamples;
+	}
+	// upper edge of the bucket holding the p-th percentile, in nanoseconds
+	double GetPercentile(double p) const
+	{
+		const long long rank = (long long)std::ceil(p / 100.0 * double(nSamples));
+		long long seen = 0;
+		for (int i = 0; i < nBuckets; i++)
+		{
+			seen += counts[i];
+			if (seen >= std::max(1ll, rank))
+			{
+				const int exponent = i / nSubBuckets;
+				return std::ldexp(1.0 + double(i % nSubBuckets + 1) / nSubBuckets, exponent);
+			}
+		}
+		return 0.0;
+	}
+private:
+	static int GetBucket(long long ns)
+	{
+		int exponent = 0;
+		while ((ns >> exponent) > 1)
+		{
+			exponent++;
+		}
+		const int subBucket = exponent >= 4 ? int((ns >> (exponent - 4)) & 15) : int((ns << (4 - exponent)) & 15);
+		return exponent * nSubBuckets + subBucket;
+	}
+private:
+	static constexpr int nSubBuckets = 16;
+	static constexpr int nBuckets = 64 * nSubBuckets;
+	long long counts[nBuckets] = {};
+	long long nSamples = 0;
+};
+
+struct ThreadStats
+{
+	std::unique_ptr<PlayStrategy> strategy;
+	LatencyHistogram latencies;
+	long long nMoves = 0;
+	int nWins = 0;
+};
+
+int main(int argc, char** argv)
+{
+	const std::string strategyName = argc > 1 ? argv[1] : "solver";
+	const int nGames = argc > 2 ? std::atoi(argv[2]) : 2000;
+	const int width = argc > 3 ? std::atoi(argv[3]) : 30;
+	const int height = argc > 4 ? std::atoi(argv[4]) : 16;
+	const int nMines = argc > 5 ? std::atoi(argv[5]) : 99;
+	const int nThreads = argc > 6 ? std::atoi(argv[6]) : int(std::max(1u, std::thread::hardware_concurrency()));
+	const uint64_t seed = argc > 7 ? std::strtoull(argv[7], nullptr, 10) : 2016u;
+
+	std::vector<ThreadStats> stats(std::max(1, nThreads));
+	for (ThreadStats& threadStats : stats)
+	{
+		threadStats.strategy = PlayStrategy::Create(strategyName);
+		if (!threadStats.strategy)
+		{
+			std::printf("unknown strategy '%s' (random, solver, linear)\n", strategyName.c_str());
+			return 1;
+		}
+	}
+	std::printf("strategy %s, %d games of %dx%d with %d mines, %d threads, seed %llu\n", strategyName.c_str(), nGames,
+		width, height, nMines, int(stats.size()), (unsigned long long)seed);
+
+	const auto start = std::chrono::steady_clock::now();
+	ParallelForStealing(nGames, int(stats.size()), [&](int game, int thread)
+	{
+		ThreadStats& threadStats = stats[thread];
+		MineField field(width, height, nMines, seed + uint64_t(game), 1);
+		threadStats.strategy->Reset(field);
+		while (field.GetGameState() == MineField::GameState::Playing)
+		{
+			const auto moveStart = std::chrono::steady_clock::now();
+			const PlayStrategy::Move move = threadStats.strategy->NextMove(field);
+			if (move.isFlag)
+			{
+				field.OnFlagClick(move.gridPos);
+			}
+			else
+			{
+				field.OnRevealClick(move.gridPos);
+			}
+			threadStats.latencies.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - moveStart).count());
+			threadStats.nMoves++;
+		}
+		if (field.GetGameState() == MineField::GameState::Win)
+		{
+			threadStats.nWins++;
+		}
+	});
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	LatencyHistogram latencies;
+	long long nMoves = 0;
+	int nWins = 0;
+	for (const ThreadStats& threadStats : stats)
+	{
+		latencies.Merge(threadStats.latencies);
+		nMoves += threadStats.nMoves;
+		nWins += threadStats.nWins;
+	}
+	std::printf("%.2f s, %.1f games/s, %.0f moves/s, win rate %.2f%%\n", seconds, nGames / seconds, nMoves / seconds,
+		100.0 * nWins / std::max(1, nGames));
+	std::printf("move latency us: p50 %.2f  p90 %.2f  p99 %.2f  p99.9 %.2f  max %.2f\n",
+		latencies.GetPercentile(50.0) / 1e3, latencies.GetPercentile(90.0) / 1e3, latencies.GetPercentile(99.0) / 1e3,
+		latencies.GetPercentile(99.9) / 1e3, latencies.GetPercentile(100.0) / 1e3);
+	return 0;
+}
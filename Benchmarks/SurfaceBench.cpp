@@ -0,0 +1,241 @@
+// Checks Surface::Copy / CopyKeyed (what Graphics::DrawSprite draws with)
+// against a per-pixel reference and reports how fast they copy. Every copy
+// must change exactly the pixels of its footprint that lie inside both the
+// clip and the destination, keyed copies leaving out the key colour, and
+// nothing else. The cases cover copies hanging off each edge or entirely
+// outside, negative positions, empty and off-surface clips, empty source
+// rectangles, odd widths, sources taken from the edges of the source image,
+// and key runs of every length, including rows that start or end on one.
+// usage: SurfaceBench [random copies] [seed]
+#include "CounterRng.h"
+#include "Graphics.h"
+#include "Surface.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static constexpr Color key = Colors::Magenta;
+
+struct CopyCase
+{
+	RectI srcRect;
+	Vei2 dstPos;
+	RectI clip;
+};
+
+static bool IsInside(const RectI& rect, int x, int y)
+{
+	return x >= rect.left && x < rect.right && y >= rect.top && y < rect.bottom;
+}
+
+// the copy one pixel at a time, straight from the description
+static void ReferenceCopy(Surface& dst, const Surface& src, const CopyCase& c, bool isKeyed)
+{
+	for (int sy = c.srcRect.top; sy < c.srcRect.bottom; sy++)
+	{
+		for (int sx = c.srcRect.left; sx < c.srcRect.right; sx++)
+		{
+			const int x = c.dstPos.x + sx - c.srcRect.left;
+			const int y = c.dstPos.y + sy - c.srcRect.top;
+			const Color color = src.GetPixel(sx, sy);
+			if (IsInside(c.clip, x, y) && IsInside(dst.GetRect(), x, y) && !(isKeyed && color.dword == key.dword))
+			{
+				dst.PutPixel(x, y, color);
+			}
+		}
+	}
+}
+
+static bool FindDifference(const Surface& a, const Surface& b, Vei2& at)
+{
+	for (at.y = 0; at.y < a.GetHeight(); at.y++)
+	{
+		for (at.x = 0; at.x < a.GetWidth(); at.x++)
+		{
+			if (a.GetPixel(at.x, at.y).dword != b.GetPixel(at.x, at.y).dword)
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+static bool CheckCopy(Surface& dst, Surface& expected, const Surface& src, const CopyCase& c, bool isKeyed)
+{
+	expected = dst;
+	ReferenceCopy(expected, src, c, isKeyed);
+	if (isKeyed)
+	{
+		dst.CopyKeyed(src, c.srcRect, c.dstPos, c.clip, key);
+	}
+	else
+	{
+		dst.Copy(src, c.srcRect, c.dstPos, c.clip);
+	}
+	Vei2 at;
+	if (FindDifference(dst, expected, at))
+	{
+		std::printf("%s copy of %d..%d x %d..%d to %d,%d clipped to %d..%d x %d..%d: pixel %d,%d is %08x, expected %08x\n",
+			isKeyed ? "keyed" : "plain", c.srcRect.left, c.srcRect.right, c.srcRect.top, c.srcRect.bottom,
+			c.dstPos.x, c.dstPos.y, c.clip.left, c.clip.right, c.clip.top, c.clip.bottom, at.x, at.y,
+			unsigned(dst.GetPixel(at.x, at.y).dword), unsigned(expected.GetPixel(at.x, at.y).dword));
+		return false;
+	}
+	return true;
+}
+
+// a rectangle inside 0..size on both axes, possibly empty
+static RectI RandomRectIn(CounterRng& rng, int width, int height)
+{
+	const int left = int(rng.UniformBelow(width + 1));
+	const int top = int(rng.UniformBelow(height + 1));
+	return RectI(left, left + int(rng.UniformBelow(width - left + 1)),
+		top, top + int(rng.UniformBelow(height - top + 1)));
+}
+
+int main(int argc, char** argv)
+{
+	const int nRandomCopies = argc > 1 ? std::atoi(argv[1]) : 20000;
+	const uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 99;
+	CounterRng rng(seed, 0);
+
+	// an odd sized sprite sheet; a third of its pixels are the key, in runs
+	// from one pixel to whole rows
+	Surface src(37, 29);
+	for (int y = 0; y < src.GetHeight(); y++)
+	{
+		for (int x = 0; x < src.GetWidth(); )
+		{
+			const int runLength = y % 7 == 3 ? src.GetWidth() : 1 + int(rng.UniformBelow(6));
+			const bool isKey = rng.UniformBelow(3) == 0;
+			for (const int end = std::min(x + runLength, src.GetWidth()); x < end; x++)
+			{
+				// blue below 255 keeps the other colours off the key
+				src.PutPixel(x, y, isKey ? key : Color(uint8_t(rng.Next()), uint8_t(y), uint8_t(x)));
+			}
+		}
+	}
+	Surface dst(53, 41);
+	Surface expected(dst.GetWidth(), dst.GetHeight());
+	const RectI dstRect = dst.GetRect();
+	const RectI srcRect = src.GetRect();
+	const int w = src.GetWidth();
+	const int h = src.GetHeight();
+
+	std::vector<CopyCase> cases = {
+		// inside, and hanging off each edge and corner
+		{ srcRect,{ 5,6 },dstRect },
+		{ srcRect,{ -10,4 },dstRect },
+		{ srcRect,{ 30,4 },dstRect },
+		{ srcRect,{ 4,-20 },dstRect },
+		{ srcRect,{ 4,30 },dstRect },
+		{ srcRect,{ -30,-25 },dstRect },
+		{ srcRect,{ 40,35 },dstRect },
+		// just outside each edge, and touching it from outside
+		{ srcRect,{ -w,0 },dstRect },
+		{ srcRect,{ dst.GetWidth(),0 },dstRect },
+		{ srcRect,{ 0,-h },dstRect },
+		{ srcRect,{ 0,dst.GetHeight() },dstRect },
+		{ srcRect,{ -w + 1,-h + 1 },dstRect },
+		{ srcRect,{ -1000,-1000 },dstRect },
+		// clips: inside, empty, off the surface, straddling it, larger than it
+		{ srcRect,{ 2,2 },RectI(10,20,5,15) },
+		{ srcRect,{ 2,2 },RectI(10,10,5,15) },
+		{ srcRect,{ 2,2 },RectI(-20,-5,-20,-5) },
+		{ srcRect,{ 2,2 },RectI(60,90,0,40) },
+		{ srcRect,{ -5,-5 },RectI(-10,12,-10,12) },
+		{ srcRect,{ 20,20 },RectI(-100,100,-100,100) },
+		// empty and one-pixel sources, and sources along the sheet's edges
+		{ RectI(5,5,3,9),{ 1,1 },dstRect },
+		{ RectI(5,9,3,3),{ 1,1 },dstRect },
+		{ RectI(0,1,0,1),{ 0,0 },dstRect },
+		{ RectI(w - 1,w,h - 1,h),{ dst.GetWidth() - 1,dst.GetHeight() - 1 },dstRect },
+		{ RectI(0,w,h - 1,h),{ -3,7 },dstRect },
+		{ RectI(w - 1,w,0,h),{ 8,-3 },dstRect },
+		{ RectI(3,16,3,8),{ 47,38 },dstRect }
+	};
+	// random sources, positions and clips, most of them partly off the surface
+	for (int i = 0; i < nRandomCopies; i++)
+	{
+		CopyCase c;
+		c.srcRect = RandomRectIn(rng, w, h);
+		c.dstPos = { int(rng.UniformBelow(dst.GetWidth() + 2 * w)) - w,int(rng.UniformBelow(dst.GetHeight() + 2 * h)) - h };
+		c.clip = i % 4 == 0 ? dstRect : RandomRectIn(rng, dst.GetWidth() + 20, dst.GetHeight() + 20);
+		if (i % 4 == 1)
+		{
+			c.clip = RectI(c.clip.left - 10, c.clip.right - 10, c.clip.top - 10, c.clip.bottom - 10);
+		}
+		cases.push_back(c);
+	}
+
+	// each case lands on whatever the cases before it left behind
+	for (const CopyCase& c : cases)
+	{
+		for (bool isKeyed : { false,true })
+		{
+			if (!CheckCopy(dst, expected, src, c, isKeyed))
+			{
+				return 1;
+			}
+		}
+	}
+
+	// DrawSprite is the same copy on the frame, clipped to the screen as well
+	Graphics gfx;
+	Surface frame = gfx.GetFrame();
+	const CopyCase spriteCases[] = {
+		{ srcRect,{ -7,-9 },gfx.GetRect() },
+		{ srcRect,{ Graphics::ScreenWidth - 11,Graphics::ScreenHeight - 13 },gfx.GetRect() },
+		{ RectI(4,30,2,20),{ 100,50 },RectI(110,400,0,60) }
+	};
+	for (const CopyCase& c : spriteCases)
+	{
+		for (bool isKeyed : { false,true })
+		{
+			ReferenceCopy(frame, src, c, isKeyed);
+			if (isKeyed)
+			{
+				gfx.DrawSprite(c.dstPos.x, c.dstPos.y, c.srcRect, c.clip, src, key);
+			}
+			else
+			{
+				gfx.DrawSprite(c.dstPos.x, c.dstPos.y, c.srcRect, c.clip, src);
+			}
+			Vei2 at;
+			if (FindDifference(gfx.GetFrame(), frame, at))
+			{
+				std::printf("DrawSprite at %d,%d: pixel %d,%d differs\n", c.dstPos.x, c.dstPos.y, at.x, at.y);
+				return 1;
+			}
+		}
+	}
+	std::printf("%d copies and %d sprites match the per-pixel reference, plain and keyed\n",
+		int(cases.size()), int(sizeof(spriteCases) / sizeof(spriteCases[0])));
+
+	// the whole sheet drawn over and over into a screen sized surface
+	Surface screen(Graphics::ScreenWidth, Graphics::ScreenHeight);
+	const int nDraws = 200000;
+	for (bool isKeyed : { false,true })
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < nDraws; i++)
+		{
+			const Vei2 pos = { i * 13 % (Graphics::ScreenWidth - w),i * 7 % (Graphics::ScreenHeight - h) };
+			if (isKeyed)
+			{
+				screen.CopyKeyed(src, srcRect, pos, screen.GetRect(), key);
+			}
+			else
+			{
+				screen.Copy(src, srcRect, pos, screen.GetRect());
+			}
+		}
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::printf("%s copy  %7.1f Mpixels/s (%.0f ns per %dx%d sprite)\n", isKeyed ? "keyed" : "plain",
+			double(nDraws) * w * h / seconds / 1e6, seconds * 1e9 / nDraws, w, h);
+	}
+	return 0;
+}
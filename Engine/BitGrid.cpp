@@ -0,0 +1,54 @@
+#include "BitGrid.h"
+#include <assert.h>
+#include <algorithm>
+
+BitGrid::BitGrid(int width, int height)
+	:
+	width(width),
+	height(height),
+	wordsPerRow((width + 63) / 64),
+	words(size_t(wordsPerRow) * height, 0u)
+{
+	assert(width > 0 && height > 0);
+}
+
+int BitGrid::GetWidth() const
+{
+	return width;
+}
+
+int BitGrid::GetHeight() const
+{
+	return height;
+}
+
+int BitGrid::GetWordsPerRow() const
+{
+	return wordsPerRow;
+}
+
+uint64_t BitGrid::GetTailMask() const
+{
+	const int tailBits = width & 63;
+	return tailBits == 0 ? ~uint64_t(0) : (uint64_t(1) << tailBits) - 1u;
+}
+
+long long BitGrid::Count() const
+{
+	long long count = 0;
+	for (uint64_t word : words)
+	{
+		count += Popcount(word);
+	}
+	return count;
+}
+
+void BitGrid::ClearAll()
+{
+	std::fill(words.begin(), words.end(), uint64_t(0));
+}
+
+size_t BitGrid::GetMemoryBytes() const
+{
+	return words.size() * sizeof(uint64_t);
+}
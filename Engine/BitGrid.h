@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// One bit per tile, row-major. Every row starts on a fresh 64-bit word and the
+// padding bits past the row end are kept zero, so whole-row/whole-board queries
+// can work a word at a time.
+class BitGrid
+{
+public:
+	BitGrid(int width, int height);
+	bool Get(int x, int y) const
+	{
+		return (Row(y)[x >> 6] >> (x & 63)) & 1u;
+	}
+	void Set(int x, int y)
+	{
+		Row(y)[x >> 6] |= uint64_t(1) << (x & 63);
+	}
+	void Clear(int x, int y)
+	{
+		Row(y)[x >> 6] &= ~(uint64_t(1) << (x & 63));
+	}
+	void Toggle(int x, int y)
+	{
+		Row(y)[x >> 6] ^= uint64_t(1) << (x & 63);
+	}
+	uint64_t* Row(int y)
+	{
+		return &words[size_t(y) * wordsPerRow];
+	}
+	const uint64_t* Row(int y) const
+	{
+		return &words[size_t(y) * wordsPerRow];
+	}
+	int GetWidth() const;
+	int GetHeight() const;
+	int GetWordsPerRow() const;
+	// mask of the valid bits in the last word of each row
+	uint64_t GetTailMask() const;
+	long long Count() const;
+	void ClearAll();
+	size_t GetMemoryBytes() const;
+	static int Popcount(uint64_t word)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		return int(__popcnt64(word));
+#elif defined(__GNUC__)
+		return __builtin_popcountll(word);
+#else
+		word = word - ((word >> 1) & 0x5555555555555555ull);
+		word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+		word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+		return int((word * 0x0101010101010101ull) >> 56);
+#endif
+	}
+	// index of the lowest set bit; word must not be zero
+	static int CountTrailingZeros(uint64_t word)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return int(index);
+#elif defined(__GNUC__)
+		return __builtin_ctzll(word);
+#else
+		return Popcount((word & (~word + 1)) - 1);
+#endif
+	}
+private:
+	int width;
+	int height;
+	int wordsPerRow;
+	std::vector<uint64_t> words;
+};
@@ -0,0 +1,121 @@
+#include "BoardAnalysis.h"
+#include "OpeningIndex.h"
+#include "Parallel.h"
+#include <assert.h>
+#include <algorithm>
+
+constexpr int BoardAnalysis::boardsPerTask;
+
+BoardAnalysis::Stats BoardAnalysis::Analyze(const MineField& field)
+{
+	assert(field.IsGenerated());
+	const int width = field.GetWidth();
+	const int height = field.GetHeight();
+	const BitGrid& mines = field.GetMines();
+	const NibbleGrid& counts = field.GetNeighbourCounts();
+	const int wordsPerRow = mines.GetWordsPerRow();
+
+	OpeningIndex::ZeroRuns zeroRuns(width, height);
+	OpeningIndex::FindZeroRuns(mines, counts, zeroRuns);
+	const BitGrid& zeros = zeroRuns.zeros;
+	const std::vector<OpeningIndex::Span>& runs = zeroRuns.runs;
+	const std::vector<size_t>& rowStarts = zeroRuns.rowStarts;
+	Stats stats = {};
+	stats.nOpenings = zeroRuns.nOpenings;
+	std::vector<int> openingSizes(zeroRuns.nOpenings, 0);
+	for (size_t run = 0; run < runs.size(); run++)
+	{
+		openingSizes[zeroRuns.openings[run]] += runs[run].xEnd - runs[run].xStart + 1;
+	}
+
+	// safe numbers next to a zero belong to the border of every opening they
+	// touch; the rest are islands
+	auto dilate = [](uint64_t left, uint64_t centre, uint64_t right)
+	{
+		return centre | (centre << 1) | (left >> 63) | (centre >> 1) | (right << 63);
+	};
+	auto getZeroWord = [&](int y, int i)
+	{
+		return y < 0 || y >= height || i < 0 || i >= wordsPerRow ? uint64_t(0) : zeros.Row(y)[i];
+	};
+	for (int y = 0; y < height; y++)
+	{
+		// first run of rows y-1..y+1 that can still reach the current x;
+		// numbers are visited left to right, so these only move forward
+		const int firstRow = std::max(0, y - 1);
+		const int lastRow = std::min(height - 1, y + 1);
+		size_t cursors[3];
+		for (int row = firstRow; row <= lastRow; row++)
+		{
+			cursors[row - firstRow] = rowStarts[row];
+		}
+		for (int i = 0; i < wordsPerRow; i++)
+		{
+			uint64_t columns[3];
+			for (int column = 0; column < 3; column++)
+			{
+				columns[column] = getZeroWord(y - 1, i - 1 + column) | getZeroWord(y, i - 1 + column) |
+					getZeroWord(y + 1, i - 1 + column);
+			}
+			const uint64_t validMask = i == wordsPerRow - 1 ? mines.GetTailMask() : ~uint64_t(0);
+			const uint64_t numbers = ~mines.Row(y)[i] & ~zeros.Row(y)[i] & validMask;
+			const uint64_t nearZero = dilate(columns[0], columns[1], columns[2]);
+			stats.nIslands += BitGrid::Popcount(numbers & ~nearZero);
+
+			for (uint64_t bits = numbers & nearZero; bits != 0; bits &= bits - 1)
+			{
+				const int x = i * 64 + BitGrid::CountTrailingZeros(bits);
+				int nearOpenings[9];
+				int nNear = 0;
+				for (int row = firstRow; row <= lastRow; row++)
+				{
+					size_t& cursor = cursors[row - firstRow];
+					const size_t rowEnd = rowStarts[row + 1];
+					while (cursor < rowEnd && runs[cursor].xEnd < x - 1)
+					{
+						cursor++;
+					}
+					for (size_t run = cursor; run < rowEnd && runs[run].xStart <= x + 1; run++)
+					{
+						const int opening = zeroRuns.openings[run];
+						if (std::find(nearOpenings, nearOpenings + nNear, opening) == nearOpenings + nNear)
+						{
+							nearOpenings[nNear++] = opening;
+						}
+					}
+				}
+				for (int j = 0; j < nNear; j++)
+				{
+					openingSizes[nearOpenings[j]]++;
+				}
+			}
+		}
+	}
+
+	for (int size : openingSizes)
+	{
+		stats.largestOpening = std::max(stats.largestOpening, size);
+	}
+	stats.bbbv = stats.nOpenings + stats.nIslands;
+	return stats;
+}
+
+std::vector<BoardAnalysis::Stats> BoardAnalysis::AnalyzeSeeds(int nBoards, int width, int height, int nMines,
+	const Vei2& safePos, uint64_t firstSeed, int nThreads)
+{
+	assert(nBoards >= 0);
+	std::vector<Stats> stats(nBoards);
+	const int nTasks = (nBoards + boardsPerTask - 1) / boardsPerTask;
+	// each board is generated single-threaded; the parallelism is across boards
+	ParallelFor(nTasks, nThreads, [&](int task)
+	{
+		const int end = std::min(nBoards, (task + 1) * boardsPerTask);
+		for (int i = task * boardsPerTask; i < end; i++)
+		{
+			MineField field(width, height, nMines, firstSeed + i, 1);
+			field.Generate(safePos);
+			stats[i] = Analyze(field);
+		}
+	});
+	return stats;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "Vei2.h"
+#include "MineField.h"
+#include <cstdint>
+#include <vector>
+
+// Difficulty figures of a generated board, from its mines and neighbour
+// counts only (the play state is ignored). An opening is a connected region
+// of zero tiles, 8-connected, which one click reveals together with its
+// numbered border; every safe number outside all borders needs a click of its
+// own. 3BV, the fewest clicks that clear the board, is the sum of the two.
+class BoardAnalysis
+{
+public:
+	struct Stats
+	{
+		// 3BV
+		int bbbv;
+		int nOpenings;
+		// safe numbered tiles no opening reaches
+		int nIslands;
+		// tiles revealed by clicking the largest opening, border included
+		int largestOpening;
+	};
+public:
+	// the field must be generated
+	static Stats Analyze(const MineField& field);
+	// boards MineField(width, height, nMines, firstSeed + i) generated around
+	// safePos, for i in [0, nBoards); the result does not depend on nThreads
+	static std::vector<Stats> AnalyzeSeeds(int nBoards, int width, int height, int nMines, const Vei2& safePos,
+		uint64_t firstSeed, int nThreads = 0);
+private:
+	// boards per ParallelFor index in AnalyzeSeeds
+	static constexpr int boardsPerTask = 256;
+};
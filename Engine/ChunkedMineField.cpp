@@ -0,0 +1,273 @@
+#include "ChunkedMineField.h"
+#include "MinePlacement.h"
+#include "NeighbourCountKernel.h"
+#include <assert.h>
+#include <algorithm>
+#include <cstdlib>
+
+ChunkedMineField::Chunk::Chunk()
+	:
+	mines(chunkSize, chunkSize),
+	revealed(chunkSize, chunkSize),
+	flagged(chunkSize, chunkSize),
+	neighbourCounts(chunkSize, chunkSize)
+{
+}
+
+ChunkedMineField::ChunkedMineField(int nMinesPerChunk, uint64_t seed)
+	:
+	nMinesPerChunk(nMinesPerChunk),
+	seed(seed)
+{
+	assert(nMinesPerChunk > 0 && nMinesPerChunk < chunkSize * chunkSize);
+}
+
+bool ChunkedMineField::OnRevealClick(const Vei2& gridPos)
+{
+	if (gameState == MineField::GameState::Playing && IsClosed(gridPos))
+	{
+		if (HasMine(gridPos))
+		{
+			RevealTile(gridPos);
+			gameState = MineField::GameState::Lose;
+			return true;
+		}
+		else if (GetNeighbourMineCount(gridPos) == 0)
+		{
+			RevealOpening(gridPos);
+		}
+		else
+		{
+			RevealTile(gridPos);
+		}
+	}
+	return false;
+}
+
+void ChunkedMineField::OnFlagClick(const Vei2& gridPos)
+{
+	if (gameState != MineField::GameState::Playing) return;
+	Chunk& chunk = ChunkAt(gridPos);
+	const Vei2 local = gridPos - GetChunkPos(gridPos) * chunkSize;
+	if (!chunk.revealed.Get(local.x, local.y))
+	{
+		chunk.flagged.Toggle(local.x, local.y);
+	}
+}
+
+bool ChunkedMineField::IsRevealed(const Vei2& gridPos) const
+{
+	const Chunk* chunk = FindChunk(gridPos);
+	const Vei2 local = gridPos - GetChunkPos(gridPos) * chunkSize;
+	return chunk != nullptr && chunk->revealed.Get(local.x, local.y);
+}
+
+bool ChunkedMineField::IsFlagged(const Vei2& gridPos) const
+{
+	const Chunk* chunk = FindChunk(gridPos);
+	const Vei2 local = gridPos - GetChunkPos(gridPos) * chunkSize;
+	return chunk != nullptr && chunk->flagged.Get(local.x, local.y);
+}
+
+bool ChunkedMineField::HasMine(const Vei2& gridPos)
+{
+	const Vei2 local = gridPos - GetChunkPos(gridPos) * chunkSize;
+	return ChunkAt(gridPos).mines.Get(local.x, local.y);
+}
+
+int ChunkedMineField::GetNeighbourMineCount(const Vei2& gridPos)
+{
+	const Vei2 local = gridPos - GetChunkPos(gridPos) * chunkSize;
+	return ChunkAt(gridPos).neighbourCounts.Get(local.x, local.y);
+}
+
+MineField::GameState ChunkedMineField::GetGameState() const
+{
+	return gameState;
+}
+
+int ChunkedMineField::EvictUntouchedChunks(const Vei2& gridPos, int keepRadius)
+{
+	const Vei2 centre = GetChunkPos(gridPos);
+	int nEvicted = 0;
+	for (auto it = chunks.begin(); it != chunks.end();)
+	{
+		const Vei2 chunkPos(int(int32_t(it->first >> 32)), int(int32_t(it->first)));
+		const bool isFar = std::abs(chunkPos.x - centre.x) > keepRadius || std::abs(chunkPos.y - centre.y) > keepRadius;
+		if (isFar && it->second->revealed.Count() == 0 && it->second->flagged.Count() == 0)
+		{
+			it = chunks.erase(it);
+			nEvicted++;
+		}
+		else
+		{
+			++it;
+		}
+	}
+	return nEvicted;
+}
+
+int ChunkedMineField::GetLoadedChunkCount() const
+{
+	return int(chunks.size());
+}
+
+size_t ChunkedMineField::GetMemoryBytes() const
+{
+	size_t bytes = 0;
+	for (const auto& entry : chunks)
+	{
+		const Chunk& chunk = *entry.second;
+		bytes += sizeof(Chunk) + chunk.mines.GetMemoryBytes() + chunk.revealed.GetMemoryBytes() +
+			chunk.flagged.GetMemoryBytes() + chunk.neighbourCounts.GetMemoryBytes();
+	}
+	return bytes;
+}
+
+void ChunkedMineField::SetMaxOpeningTiles(long long maxTiles)
+{
+	assert(maxTiles > 0);
+	maxOpeningTiles = maxTiles;
+}
+
+Vei2 ChunkedMineField::GetChunkPos(const Vei2& gridPos)
+{
+	// floor division, so -1 lands in chunk -1 rather than chunk 0
+	return Vei2((gridPos.x >= 0 ? gridPos.x : gridPos.x - (chunkSize - 1)) / chunkSize,
+		(gridPos.y >= 0 ? gridPos.y : gridPos.y - (chunkSize - 1)) / chunkSize);
+}
+
+uint64_t ChunkedMineField::GetChunkKey(const Vei2& chunkPos)
+{
+	return (uint64_t(uint32_t(chunkPos.x)) << 32) | uint32_t(chunkPos.y);
+}
+
+ChunkedMineField::Chunk& ChunkedMineField::ChunkAt(const Vei2& gridPos)
+{
+	const Vei2 chunkPos = GetChunkPos(gridPos);
+	std::unique_ptr<Chunk>& chunk = chunks[GetChunkKey(chunkPos)];
+	if (!chunk)
+	{
+		chunk.reset(new Chunk());
+		GenerateMines(chunkPos, chunk->mines);
+		CountNeighbourMines(chunkPos, *chunk);
+	}
+	return *chunk;
+}
+
+const ChunkedMineField::Chunk* ChunkedMineField::FindChunk(const Vei2& gridPos) const
+{
+	const auto it = chunks.find(GetChunkKey(GetChunkPos(gridPos)));
+	return it == chunks.end() ? nullptr : it->second.get();
+}
+
+void ChunkedMineField::GenerateMines(const Vei2& chunkPos, BitGrid& mines) const
+{
+	// SplitMix64 finaliser over (seed, chunk key) gives each chunk its own seed
+	uint64_t chunkSeed = seed ^ (GetChunkKey(chunkPos) * 0x9E3779B97F4A7C15ull);
+	chunkSeed = (chunkSeed ^ (chunkSeed >> 30)) * 0xBF58476D1CE4E5B9ull;
+	chunkSeed = (chunkSeed ^ (chunkSeed >> 27)) * 0x94D049BB133111EBull;
+	chunkSeed ^= chunkSeed >> 31;
+	MinePlacement::Place(mines, nMinesPerChunk, chunkSeed);
+}
+
+void ChunkedMineField::CountNeighbourMines(const Vei2& chunkPos, Chunk& chunk)
+{
+	// Run the bulk kernel over the chunk plus a one-tile halo taken from the
+	// eight neighbouring layouts, then keep the interior.
+	constexpr int haloSize = chunkSize + 2;
+	BitGrid halo(haloSize, haloSize);
+	BitGrid neighbourMines(chunkSize, chunkSize);
+	for (int dy = -1; dy <= 1; dy++)
+	{
+		for (int dx = -1; dx <= 1; dx++)
+		{
+			const Vei2 neighbourPos = chunkPos + Vei2(dx, dy);
+			const BitGrid* source = &chunk.mines;
+			if (dx != 0 || dy != 0)
+			{
+				const auto it = chunks.find(GetChunkKey(neighbourPos));
+				if (it != chunks.end() && it->second)
+				{
+					source = &it->second->mines;
+				}
+				else
+				{
+					neighbourMines.ClearAll();
+					GenerateMines(neighbourPos, neighbourMines);
+					source = &neighbourMines;
+				}
+			}
+			// only the part of each neighbour that falls inside the halo is copied
+			const int xStart = dx < 0 ? chunkSize - 1 : 0;
+			const int xEnd = dx > 0 ? 1 : chunkSize;
+			const int yStart = dy < 0 ? chunkSize - 1 : 0;
+			const int yEnd = dy > 0 ? 1 : chunkSize;
+			for (int y = yStart; y < yEnd; y++)
+			{
+				for (int x = xStart; x < xEnd; x++)
+				{
+					if (source->Get(x, y))
+					{
+						halo.Set(x + 1 + dx * chunkSize, y + 1 + dy * chunkSize);
+					}
+				}
+			}
+		}
+	}
+
+	NibbleGrid haloCounts(haloSize, haloSize);
+	NeighbourCountKernel::Compute(halo, haloCounts);
+	for (int y = 0; y < chunkSize; y++)
+	{
+		for (int x = 0; x < chunkSize; x++)
+		{
+			chunk.neighbourCounts.Set(x, y, haloCounts.Get(x + 1, y + 1));
+		}
+	}
+}
+
+bool ChunkedMineField::IsClosed(const Vei2& gridPos)
+{
+	const Chunk& chunk = ChunkAt(gridPos);
+	const Vei2 local = gridPos - GetChunkPos(gridPos) * chunkSize;
+	return !chunk.revealed.Get(local.x, local.y) && !chunk.flagged.Get(local.x, local.y);
+}
+
+void ChunkedMineField::RevealTile(const Vei2& gridPos)
+{
+	Chunk& chunk = ChunkAt(gridPos);
+	const Vei2 local = gridPos - GetChunkPos(gridPos) * chunkSize;
+	assert(!chunk.revealed.Get(local.x, local.y));
+	chunk.revealed.Set(local.x, local.y);
+}
+
+void ChunkedMineField::RevealOpening(const Vei2& gridPos)
+{
+	// Tiles are revealed as they are queued, so each one is visited once;
+	// only zeros are queued for expansion. Everything next to a zero is safe.
+	openingSeeds.clear();
+	RevealTile(gridPos);
+	openingSeeds.push_back(gridPos);
+	long long nRevealed = 1;
+	while (!openingSeeds.empty() && nRevealed < maxOpeningTiles)
+	{
+		const Vei2 zero = openingSeeds.back();
+		openingSeeds.pop_back();
+		for (Vei2 pos = { zero.x - 1, zero.y - 1 }; pos.y <= zero.y + 1; pos.y++)
+		{
+			for (pos.x = zero.x - 1; pos.x <= zero.x + 1; pos.x++)
+			{
+				if (IsClosed(pos))
+				{
+					RevealTile(pos);
+					nRevealed++;
+					if (GetNeighbourMineCount(pos) == 0)
+					{
+						openingSeeds.push_back(pos);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "Vei2.h"
+#include "BitGrid.h"
+#include "NibbleGrid.h"
+#include "MineField.h"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Endless board made of 64x64 chunks that are generated on first touch.
+// A chunk's mines come from a hash of (seed, chunk coordinates), so any chunk
+// can be rebuilt at any time; neighbour counts along chunk edges are taken
+// from the neighbouring chunks' layouts, generated on the side if they are
+// not loaded. Memory grows with the explored area, and chunks the player has
+// not revealed or flagged anything in can be evicted and regenerated later.
+class ChunkedMineField
+{
+public:
+	static constexpr int chunkSize = 64;
+public:
+	ChunkedMineField(int nMinesPerChunk, uint64_t seed);
+	// returns true if the reveal hit a mine
+	bool OnRevealClick(const Vei2& gridPos);
+	void OnFlagClick(const Vei2& gridPos);
+	bool IsRevealed(const Vei2& gridPos) const;
+	bool IsFlagged(const Vei2& gridPos) const;
+	// these generate the chunk if it is not loaded yet
+	bool HasMine(const Vei2& gridPos);
+	int GetNeighbourMineCount(const Vei2& gridPos);
+	MineField::GameState GetGameState() const;
+	// drops chunks with no revealed or flagged tiles that are more than
+	// keepRadius chunks away from gridPos; returns the number evicted
+	int EvictUntouchedChunks(const Vei2& gridPos, int keepRadius);
+	int GetLoadedChunkCount() const;
+	size_t GetMemoryBytes() const;
+	// zero-click openings stop growing after this many tiles; below the
+	// percolation density a single opening could otherwise be unbounded
+	void SetMaxOpeningTiles(long long maxTiles);
+private:
+	struct Chunk
+	{
+		Chunk();
+		BitGrid mines;
+		BitGrid revealed;
+		BitGrid flagged;
+		NibbleGrid neighbourCounts;
+	};
+private:
+	static Vei2 GetChunkPos(const Vei2& gridPos);
+	static uint64_t GetChunkKey(const Vei2& chunkPos);
+	Chunk& ChunkAt(const Vei2& gridPos);
+	const Chunk* FindChunk(const Vei2& gridPos) const;
+	void GenerateMines(const Vei2& chunkPos, BitGrid& mines) const;
+	void CountNeighbourMines(const Vei2& chunkPos, Chunk& chunk);
+	bool IsClosed(const Vei2& gridPos);
+	void RevealTile(const Vei2& gridPos);
+	void RevealOpening(const Vei2& gridPos);
+private:
+	int nMinesPerChunk;
+	uint64_t seed;
+	long long maxOpeningTiles = 1 << 22;
+	MineField::GameState gameState = MineField::GameState::Playing;
+	std::unordered_map<uint64_t, std::unique_ptr<Chunk>> chunks;
+	// zero tiles still to expand, kept between calls to avoid reallocating
+	std::vector<Vei2> openingSeeds;
+};
@@ -26,10 +26,9 @@ public:
 	unsigned int dword;
 public:
 	constexpr Color() : dword() {}
-	constexpr Color( const Color& col )
-		:
-		dword( col.dword )
-	{}
+	// defaulted, so Color stays trivially copyable and std::copy of pixel
+	// rows is a memmove
+	constexpr Color( const Color& col ) = default;
 	constexpr Color( unsigned int dw )
 		:
 		dword( dw )
@@ -46,11 +45,7 @@ public:
 		:
 		Color( (x << 24u) | col.dword )
 	{}
-	Color& operator =( Color color )
-	{
-		dword = color.dword;
-		return *this;
-	}
+	Color& operator =( const Color& color ) = default;
 	constexpr unsigned char GetX() const
 	{
 		return dword >> 24u;
@@ -0,0 +1,70 @@
+#include "CounterRng.h"
+#include <assert.h>
+
+CounterRng::CounterRng(uint64_t seed, uint64_t stream)
+	:
+	key{ uint32_t(seed), uint32_t(seed >> 32) },
+	stream(stream)
+{
+}
+
+uint64_t CounterRng::Next()
+{
+	if (nUsed > 2)
+	{
+		GenerateBlock();
+	}
+	const uint64_t value = uint64_t(block[nUsed]) | (uint64_t(block[nUsed + 1]) << 32);
+	nUsed += 2;
+	return value;
+}
+
+uint64_t CounterRng::UniformBelow(uint64_t bound)
+{
+	assert(bound > 0);
+	// reject the top partial bucket so every residue is equally likely
+	const uint64_t limit = ~uint64_t(0) - (~uint64_t(0) % bound + 1) % bound;
+	uint64_t value;
+	do
+	{
+		value = Next();
+	} while (value > limit);
+	return value % bound;
+}
+
+double CounterRng::NextDouble()
+{
+	return double(Next() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void CounterRng::GenerateBlock()
+{
+	// counter = (block index, stream), 10 Philox rounds with Weyl key schedule
+	uint32_t c0 = uint32_t(blockIndex);
+	uint32_t c1 = uint32_t(blockIndex >> 32);
+	uint32_t c2 = uint32_t(stream);
+	uint32_t c3 = uint32_t(stream >> 32);
+	uint32_t k0 = key[0];
+	uint32_t k1 = key[1];
+	for (int round = 0; round < 10; round++)
+	{
+		const uint64_t product0 = uint64_t(0xD2511F53u) * c0;
+		const uint64_t product1 = uint64_t(0xCD9E8D57u) * c2;
+		const uint32_t hi0 = uint32_t(product0 >> 32);
+		const uint32_t lo0 = uint32_t(product0);
+		const uint32_t hi1 = uint32_t(product1 >> 32);
+		const uint32_t lo1 = uint32_t(product1);
+		c0 = hi1 ^ c1 ^ k0;
+		c1 = lo1;
+		c2 = hi0 ^ c3 ^ k1;
+		c3 = lo0;
+		k0 += 0x9E3779B9u;
+		k1 += 0xBB67AE85u;
+	}
+	block[0] = c0;
+	block[1] = c1;
+	block[2] = c2;
+	block[3] = c3;
+	blockIndex++;
+	nUsed = 0;
+}
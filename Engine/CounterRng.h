@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+// Philox4x32-10 counter-based generator. The output is a pure function of
+// (seed, stream, position), so independent streams -- e.g. one per row band
+// of a board -- can be drawn on any thread in any order and still give the
+// same numbers.
+class CounterRng
+{
+public:
+	CounterRng(uint64_t seed, uint64_t stream);
+	uint64_t Next();
+	// uniform in [0, bound), unbiased
+	uint64_t UniformBelow(uint64_t bound);
+	// uniform in [0, 1) with 53 random bits
+	double NextDouble();
+private:
+	void GenerateBlock();
+private:
+	uint32_t key[2];
+	uint64_t stream;
+	uint64_t blockIndex = 0;
+	uint32_t block[4];
+	int nUsed = 4;
+};
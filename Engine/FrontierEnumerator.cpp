@@ -0,0 +1,402 @@
+#include "FrontierEnumerator.h"
+#include "BitGrid.h"
+#include "Parallel.h"
+#include <assert.h>
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <unordered_map>
+
+constexpr int FrontierEnumerator::maxCells;
+constexpr int FrontierEnumerator::maxWords;
+
+namespace
+{
+	double Binomial(int n, int k)
+	{
+		double result = 1.0;
+		for (int i = 1; i <= k; i++)
+		{
+			result = result * (n - k + i) / i;
+		}
+		return result;
+	}
+}
+
+std::vector<FrontierEnumerator::Component> FrontierEnumerator::FindComponents(const MineField& field)
+{
+	const int width = field.GetWidth();
+	const int height = field.GetHeight();
+	std::vector<Vei2> cells;
+	std::vector<Constraint> constraints;
+	std::unordered_map<long long, int> cellIds;
+	field.GetConstraintTiles().ForEach([&](const Vei2& pos)
+	{
+		Constraint constraint;
+		constraint.nMines = field.TileAt(pos).GetNeighbourMineCount();
+		for (Vei2 other = { std::max(0, pos.x - 1), std::max(0, pos.y - 1) }; other.y <= std::min(height - 1, pos.y + 1); other.y++)
+		{
+			for (other.x = std::max(0, pos.x - 1); other.x <= std::min(width - 1, pos.x + 1); other.x++)
+			{
+				const MineField::Tile otherTile = field.TileAt(other);
+				if (otherTile.IsFlagged())
+				{
+					constraint.nMines--;
+				}
+				else if (otherTile.IsHidden())
+				{
+					const auto inserted = cellIds.emplace(static_cast<long long>(other.y) * width + other.x, int(cells.size()));
+					if (inserted.second)
+					{
+						cells.push_back(other);
+					}
+					constraint.cells.push_back(inserted.first->second);
+				}
+			}
+		}
+		constraints.push_back(std::move(constraint));
+	});
+
+	// breadth-first over the cells through the numbers they share
+	std::vector<std::vector<int>> cellConstraints(cells.size());
+	for (int i = 0; i < int(constraints.size()); i++)
+	{
+		for (int cell : constraints[i].cells)
+		{
+			cellConstraints[cell].push_back(i);
+		}
+	}
+	std::vector<Component> components;
+	std::vector<int> componentIds(cells.size(), -1);
+	std::vector<int> localIds(cells.size(), 0);
+	std::vector<int> queue;
+	for (int start = 0; start < int(cells.size()); start++)
+	{
+		if (componentIds[start] >= 0) continue;
+		const int componentId = int(components.size());
+		components.emplace_back();
+		Component& component = components.back();
+		queue.assign(1, start);
+		componentIds[start] = componentId;
+		for (size_t i = 0; i < queue.size(); i++)
+		{
+			const int cell = queue[i];
+			localIds[cell] = int(component.cells.size());
+			component.cells.push_back(cells[cell]);
+			for (int constraint : cellConstraints[cell])
+			{
+				for (int other : constraints[constraint].cells)
+				{
+					if (componentIds[other] < 0)
+					{
+						componentIds[other] = componentId;
+						queue.push_back(other);
+					}
+				}
+			}
+		}
+	}
+	for (Constraint& constraint : constraints)
+	{
+		Component& component = components[componentIds[constraint.cells.front()]];
+		for (int& cell : constraint.cells)
+		{
+			cell = localIds[cell];
+		}
+		component.constraints.push_back(std::move(constraint));
+	}
+	return components;
+}
+
+FrontierEnumerator::FrontierEnumerator(const Component& component, int maxMines, int nThreads)
+	:
+	nCells(int(component.cells.size())),
+	nWords((nCells + 63) / 64),
+	maxMines(std::min(maxMines, nCells))
+{
+	assert(nCells <= maxCells);
+	assert(maxMines >= 0);
+	FindOrder(component);
+
+	const int nConstraints = int(component.constraints.size());
+	masks.assign(size_t(nConstraints) * maxWords, 0u);
+	firstWords.assign(nConstraints, maxWords);
+	lastWords.assign(nConstraints, -1);
+	checks.assign(nCells, std::vector<Check>());
+	for (int c = 0; c < nConstraints; c++)
+	{
+		const Constraint& constraint = component.constraints[c];
+		nConstraintMines.push_back(constraint.nMines);
+		for (int cell : constraint.cells)
+		{
+			const int position = positions[cell];
+			masks[size_t(c) * maxWords + (position >> 6)] |= uint64_t(1) << (position & 63);
+			firstWords[c] = std::min(firstWords[c], position >> 6);
+			lastWords[c] = std::max(lastWords[c], position >> 6);
+			int nLaterCells = 0;
+			for (int other : constraint.cells)
+			{
+				if (positions[other] > position)
+				{
+					nLaterCells++;
+				}
+			}
+			checks[position].push_back({ c, nLaterCells });
+		}
+	}
+	Run(nThreads);
+}
+
+double FrontierEnumerator::GetSolutionCount() const
+{
+	double nSolutions = 0.0;
+	for (double count : result.histogram)
+	{
+		nSolutions += count;
+	}
+	return nSolutions;
+}
+
+const std::vector<double>& FrontierEnumerator::GetHistogram() const
+{
+	return result.histogram;
+}
+
+double FrontierEnumerator::GetMineCount(int cell) const
+{
+	double count = 0.0;
+	for (int nMines = 0; nMines <= maxMines; nMines++)
+	{
+		count += GetMineCount(cell, nMines);
+	}
+	return count;
+}
+
+double FrontierEnumerator::GetMineCount(int cell, int nMines) const
+{
+	assert(cell >= 0 && cell < nCells);
+	if (nMines < 0 || nMines > maxMines) return 0.0;
+	return result.cellCounts[size_t(nMines) * nCells + positions[cell]];
+}
+
+void FrontierEnumerator::FindOrder(const Component& component)
+{
+	// groups: cells in exactly the same numbers (lists come out ascending)
+	const int nConstraints = int(component.constraints.size());
+	std::vector<std::vector<int>> cellConstraints(nCells);
+	for (int c = 0; c < nConstraints; c++)
+	{
+		for (int cell : component.constraints[c].cells)
+		{
+			cellConstraints[cell].push_back(c);
+		}
+	}
+	std::map<std::vector<int>, int> groupIds;
+	std::vector<int> cellGroups(nCells);
+	for (int cell = 0; cell < nCells; cell++)
+	{
+		cellGroups[cell] = groupIds.emplace(cellConstraints[cell], int(groupIds.size())).first->second;
+	}
+
+	// greedy: next comes the group that leaves one of its numbers with the
+	// fewest unordered cells, preferring numbers already started, so numbers
+	// are completed (and prune) as high up the tree as possible
+	std::vector<int> nUnordered(nConstraints);
+	for (int c = 0; c < nConstraints; c++)
+	{
+		nUnordered[c] = int(component.constraints[c].cells.size());
+	}
+	std::vector<bool> isOrdered(nCells, false);
+	positions.assign(nCells, 0);
+	isGroupStart.assign(nCells, false);
+	groupEnds.assign(nCells, 0);
+	int nOrdered = 0;
+	while (nOrdered < nCells)
+	{
+		int bestCell = -1;
+		int bestScore = INT_MAX;
+		for (int cell = 0; cell < nCells; cell++)
+		{
+			if (isOrdered[cell]) continue;
+			int score = INT_MAX - 1;
+			for (int c : cellConstraints[cell])
+			{
+				const bool isStarted = nUnordered[c] < int(component.constraints[c].cells.size());
+				score = std::min(score, nUnordered[c] + (isStarted ? 0 : 9));
+			}
+			if (score < bestScore)
+			{
+				bestScore = score;
+				bestCell = cell;
+			}
+		}
+		const int groupStart = nOrdered;
+		isGroupStart[groupStart] = true;
+		for (int cell = bestCell; cell < nCells; cell++)
+		{
+			if (isOrdered[cell] || cellGroups[cell] != cellGroups[bestCell]) continue;
+			isOrdered[cell] = true;
+			positions[cell] = nOrdered++;
+			for (int c : cellConstraints[cell])
+			{
+				nUnordered[c]--;
+			}
+		}
+		groupEnds[nOrdered - 1] = nOrdered - groupStart;
+	}
+}
+
+bool FrontierEnumerator::IsFeasible(const uint64_t* mines, int position) const
+{
+	// later cells are still clear, so popcount gives the mines placed so far
+	// in each number this cell touches
+	for (const Check& check : checks[position])
+	{
+		const uint64_t* mask = &masks[size_t(check.constraint) * maxWords];
+		int nMines = 0;
+		for (int w = firstWords[check.constraint]; w <= lastWords[check.constraint]; w++)
+		{
+			nMines += BitGrid::Popcount(mines[w] & mask[w]);
+		}
+		const int nNeeded = nConstraintMines[check.constraint];
+		if (nMines > nNeeded || nMines + check.nLaterCells < nNeeded)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename Visit>
+void FrontierEnumerator::Branch(const Prefix& prefix, int position, Visit&& visit) const
+{
+	const int nGroupMines = isGroupStart[position] ? 0 : prefix.nGroupMines;
+	const int groupSize = groupEnds[position];
+	Prefix child = prefix;
+	child.nGroupMines = nGroupMines;
+	if (IsFeasible(child.mines, position))
+	{
+		if (groupSize > 0)
+		{
+			child.weight = prefix.weight * Binomial(groupSize, nGroupMines);
+		}
+		visit(child);
+	}
+
+	// within a group a mine may only follow a mine
+	const bool isPacked = isGroupStart[position] || ((prefix.mines[(position - 1) >> 6] >> ((position - 1) & 63)) & 1u);
+	if (prefix.nMines < maxMines && isPacked)
+	{
+		child = prefix;
+		child.mines[position >> 6] |= uint64_t(1) << (position & 63);
+		child.nMines++;
+		child.nGroupMines = nGroupMines + 1;
+		if (IsFeasible(child.mines, position))
+		{
+			if (groupSize > 0)
+			{
+				child.weight = prefix.weight * Binomial(groupSize, nGroupMines + 1);
+			}
+			visit(child);
+		}
+	}
+}
+
+void FrontierEnumerator::Run(int nThreads)
+{
+	if (nThreads <= 0)
+	{
+		nThreads = int(std::max(1u, std::thread::hardware_concurrency()));
+	}
+
+	// expand the top of the tree breadth-first until there are enough
+	// disjoint subtrees for the threads to share
+	const size_t nTargetPrefixes = nThreads > 1 ? size_t(nThreads) * 64 : 1;
+	std::vector<Prefix> prefixes(1, Prefix());
+	std::fill(std::begin(prefixes[0].mines), std::end(prefixes[0].mines), 0u);
+	prefixes[0].nMines = 0;
+	prefixes[0].nGroupMines = 0;
+	prefixes[0].weight = 1.0;
+	int depth = 0;
+	std::vector<Prefix> next;
+	for (; prefixes.size() < nTargetPrefixes && depth < nCells; depth++)
+	{
+		next.clear();
+		for (const Prefix& prefix : prefixes)
+		{
+			Branch(prefix, depth, [&](const Prefix& child)
+			{
+				next.push_back(child);
+			});
+		}
+		prefixes.swap(next);
+	}
+
+	const size_t nCounts = size_t(maxMines) + 1;
+	std::vector<Counts> threadCounts(std::max(1, std::min(nThreads, int(prefixes.size()))));
+	for (Counts& counts : threadCounts)
+	{
+		counts.histogram.assign(nCounts, 0.0);
+		counts.cellCounts.assign(nCounts * nCells, 0.0);
+	}
+	ParallelForStealing(int(prefixes.size()), int(threadCounts.size()), [&](int i, int thread)
+	{
+		Search(prefixes[i], depth, threadCounts[thread]);
+	});
+
+	result = std::move(threadCounts[0]);
+	for (size_t t = 1; t < threadCounts.size(); t++)
+	{
+		for (size_t i = 0; i < nCounts; i++)
+		{
+			result.histogram[i] += threadCounts[t].histogram[i];
+		}
+		for (size_t i = 0; i < result.cellCounts.size(); i++)
+		{
+			result.cellCounts[i] += threadCounts[t].cellCounts[i];
+		}
+	}
+
+	// the search only put mines at the start of each group; spread them
+	// evenly over its cells
+	for (int end = 0, start = 0; end < nCells; end++)
+	{
+		if (groupEnds[end] == 0) continue;
+		const int groupSize = groupEnds[end];
+		for (size_t k = 0; k < nCounts; k++)
+		{
+			double* counts = &result.cellCounts[k * nCells];
+			double total = 0.0;
+			for (int position = start; position <= end; position++)
+			{
+				total += counts[position];
+			}
+			for (int position = start; position <= end; position++)
+			{
+				counts[position] = total / groupSize;
+			}
+		}
+		start = end + 1;
+	}
+}
+
+void FrontierEnumerator::Search(const Prefix& prefix, int position, Counts& counts) const
+{
+	if (position == nCells)
+	{
+		counts.histogram[prefix.nMines] += prefix.weight;
+		double* cellCounts = &counts.cellCounts[size_t(prefix.nMines) * nCells];
+		for (int w = 0; w < nWords; w++)
+		{
+			for (uint64_t bits = prefix.mines[w]; bits != 0; bits &= bits - 1)
+			{
+				cellCounts[w * 64 + BitGrid::CountTrailingZeros(bits)] += prefix.weight;
+			}
+		}
+		return;
+	}
+	Branch(prefix, position, [&](const Prefix& child)
+	{
+		Search(child, position + 1, counts);
+	});
+}
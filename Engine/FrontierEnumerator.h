@@ -0,0 +1,94 @@
+#pragma once
+#include "Vei2.h"
+#include "MineField.h"
+#include <cstdint>
+#include <vector>
+
+// Counts the mine arrangements of one frontier component (hidden tiles tied
+// together by the numbers around them), per mine total and per cell. An
+// arrangement is a bitset over the component's cells and every number is a
+// mask over the same bits; a partial arrangement is dropped as soon as
+// popcount(mines & mask) is over the number or can no longer reach it.
+// Cells touching exactly the same numbers are interchangeable, so they sit
+// next to each other in the search order and only arrangements with a
+// group's mines packed at its start are visited, each standing for
+// C(cells, mines) arrangements. The top of the search tree is expanded until
+// there are enough disjoint subtrees to share out between threads.
+class FrontierEnumerator
+{
+public:
+	struct Constraint
+	{
+		// indices into Component::cells
+		std::vector<int> cells;
+		int nMines;
+	};
+	struct Component
+	{
+		std::vector<Vei2> cells;
+		std::vector<Constraint> constraints;
+	};
+	static constexpr int maxCells = 512;
+public:
+	// field's frontier split into components that share no number; flags
+	// count as mines and are not cells
+	static std::vector<Component> FindComponents(const MineField& field);
+	// enumerates every arrangement with at most maxMines mines
+	FrontierEnumerator(const Component& component, int maxMines, int nThreads = 0);
+	// counts are doubles since big components overflow 64 bits; they are
+	// exact while below 2^53
+	double GetSolutionCount() const;
+	// solutions by number of mines in the component
+	const std::vector<double>& GetHistogram() const;
+	// solutions with the cell mined, in total / with nMines in the component
+	double GetMineCount(int cell) const;
+	double GetMineCount(int cell, int nMines) const;
+private:
+	static constexpr int maxWords = maxCells / 64;
+	// a node of the search tree: cells before the node's depth are decided
+	struct Prefix
+	{
+		uint64_t mines[maxWords];
+		int nMines;
+		int nGroupMines;
+		double weight;
+	};
+	// a number a cell is in, and how many of its cells come later in the order
+	struct Check
+	{
+		int constraint;
+		int nLaterCells;
+	};
+	struct Counts
+	{
+		std::vector<double> histogram;
+		// nMines * nCells + position
+		std::vector<double> cellCounts;
+	};
+private:
+	void FindOrder(const Component& component);
+	bool IsFeasible(const uint64_t* mines, int position) const;
+	// tries both values for the cell at position and calls visit(child) for
+	// each that passes the checks
+	template<typename Visit>
+	void Branch(const Prefix& prefix, int position, Visit&& visit) const;
+	void Run(int nThreads);
+	void Search(const Prefix& prefix, int position, Counts& counts) const;
+private:
+	int nCells;
+	int nWords;
+	int maxMines;
+	// per constraint: cell mask (maxWords words) and the words it spans
+	std::vector<uint64_t> masks;
+	std::vector<int> firstWords;
+	std::vector<int> lastWords;
+	std::vector<int> nConstraintMines;
+	// per position in the search order
+	std::vector<std::vector<Check>> checks;
+	std::vector<bool> isGroupStart;
+	// size of the group when the position ends one, else 0
+	std::vector<int> groupEnds;
+	// search position of each component cell
+	std::vector<int> positions;
+	Counts result;
+};
@@ -22,27 +22,49 @@
 #include "Game.h"
 #include "SpriteCodex.h"
 #include <assert.h>
+#include <random>
 
 Game::Game(MainWindow & wnd)
 	:
 	wnd(wnd),
 	gfx(wnd),
-	minefield(20),
+	minefield(20, 16, 20, std::random_device()()),
+	fieldView(minefield, { Graphics::ScreenWidth / 2, Graphics::ScreenHeight / 2 }),
+	advisor(minefield),
 	loseSound(L"Sounds/lose.wav")
 {
 }
 
 void Game::Go()
 {
-	gfx.BeginFrame();
+	// the frame buffer persists and fieldView redraws only what changed, so
+	// an idle frame draws and uploads nothing; the frame is only cleared when
+	// the whole board is about to be drawn again
 	UpdateModel();
+	if (fieldView.IsFullRedrawPending())
+	{
+		gfx.BeginFrame();
+	}
 	ComposeFrame();
 	gfx.EndFrame();
 }
 
+constexpr std::chrono::microseconds Game::hintBudget;
+
 void Game::UpdateModel()
 {
-
+	while (!wnd.kbd.KeyIsEmpty())
+	{
+		const Keyboard::Event e = wnd.kbd.ReadKey();
+		if (e.IsPress() && e.GetCode() == 'H' && minefield.GetGameState() == MineField::GameState::Playing)
+		{
+			const MoveAdvisor::Hint hint = advisor.Suggest(hintBudget);
+			if (hint.gridPos.x >= 0)
+			{
+				fieldView.SetHighlight(hint.gridPos);
+			}
+		}
+	}
 
 	while (!wnd.mouse.IsEmpty())
 	{
@@ -50,20 +72,22 @@ void Game::UpdateModel()
 		if (e.GetType() == Mouse::Event::Type::LPress)
 		{
 			const Vei2 mousePos = e.GetPos();
-			if (minefield.GetRect().Contains(mousePos))
+			if (fieldView.GetRect().Contains(mousePos))
 			{
-				if (minefield.OnRevealClick(mousePos))
+				if (fieldView.OnRevealClick(mousePos))
 				{
 					loseSound.Play();
 				}
+				OnFieldChanged();
 			}
 		}
 		else if (e.GetType() == Mouse::Event::Type::RPress)
 		{
 			const Vei2 mousePos = e.GetPos();
-			if (minefield.GetRect().Contains(mousePos))
+			if (fieldView.GetRect().Contains(mousePos))
 			{
-				minefield.OnFlagClick(mousePos);
+				fieldView.OnFlagClick(mousePos);
+				OnFieldChanged();
 			}
 		}
 
@@ -71,9 +95,19 @@ void Game::UpdateModel()
 
 }
 
+void Game::OnFieldChanged()
+{
+	// no more hints once the game is over
+	if (minefield.GetGameState() == MineField::GameState::Playing)
+	{
+		advisor.Update(minefield.GetLastChangedRuns());
+	}
+	fieldView.ClearHighlight();
+}
+
 void Game::ComposeFrame()
 {
-	minefield.Draw(gfx);
+	fieldView.Draw(gfx);
 }
 
 
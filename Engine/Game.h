@@ -24,6 +24,8 @@
 #include "Mouse.h"
 #include "Graphics.h"
 #include "MineField.h"
+#include "MineFieldView.h"
+#include "MoveAdvisor.h"
 #include "Sound.h"
 
 
@@ -38,6 +40,8 @@ private:
 	void UpdateModel();
 	/********************************/
 	/*  User Functions              */
+	// after every click: keeps the advisor current and drops a stale hint
+	void OnFieldChanged();
 	/********************************/
 private:
 	MainWindow& wnd;
@@ -45,6 +49,10 @@ private:
 	/********************************/
 	/*  User Variables              */
 	MineField minefield;
+	MineFieldView fieldView;
+	MoveAdvisor advisor;
 	Sound loseSound;
+	// the most a hint may add to a frame
+	static constexpr std::chrono::microseconds hintBudget = std::chrono::microseconds(1000);
 	/********************************/
 };
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include <assert.h>
 #include <string>
 #include <array>
+#include <cstring>
 
 // Ignore the intellisense error "cannot open source file" for .shh files.
 // They will be created during the build sequence before the preprocessor runs.
@@ -41,6 +42,8 @@ namespace FramebufferShaders
 using Microsoft::WRL::ComPtr;
 
 Graphics::Graphics( HWNDKey& key )
+	:
+	sysBuffer( Graphics::ScreenWidth,Graphics::ScreenHeight )
 {
 	assert( key.hWnd != nullptr );
 
@@ -234,20 +237,10 @@ Graphics::Graphics( HWNDKey& key )
 	{
 		throw CHILI_GFX_EXCEPTION( hr,L"Creating sampler state" );
 	}
-
-	// allocate memory for sysbuffer (16-byte aligned for faster access)
-	pSysBuffer = reinterpret_cast<Color*>( 
-		_aligned_malloc( sizeof( Color ) * Graphics::ScreenWidth * Graphics::ScreenHeight,16u ) );
 }
 
 Graphics::~Graphics()
 {
-	// free sysbuffer memory (aligned free)
-	if( pSysBuffer )
-	{
-		_aligned_free( pSysBuffer );
-		pSysBuffer = nullptr;
-	}
 	// clear the state of the device context before destruction
 	if( pImmediateContext ) pImmediateContext->ClearState();
 }
@@ -256,24 +249,19 @@ void Graphics::EndFrame()
 {
 	HRESULT hr;
 
-	// lock and map the adapter memory for copying over the sysbuffer
-	if( FAILED( hr = pImmediateContext->Map( pSysBufferTexture.Get(),0u,
-		D3D11_MAP_WRITE_DISCARD,0u,&mappedSysBufferTexture ) ) )
+	if( isHeadless )
 	{
-		throw CHILI_GFX_EXCEPTION( hr,L"Mapping sysbuffer" );
+		isSysBufferChanged = false;
+		return;
 	}
-	// setup parameters for copy operation
-	Color* pDst = reinterpret_cast<Color*>(mappedSysBufferTexture.pData );
-	const size_t dstPitch = mappedSysBufferTexture.RowPitch / sizeof( Color );
-	const size_t srcPitch = Graphics::ScreenWidth;
-	const size_t rowBytes = srcPitch * sizeof( Color );
-	// perform the copy line-by-line
-	for( size_t y = 0u; y < Graphics::ScreenHeight; y++ )
+
+	// the texture keeps the last upload until the next map, so a frame that
+	// drew nothing only needs presenting
+	if( isSysBufferChanged )
 	{
-		memcpy( &pDst[ y * dstPitch ],&pSysBuffer[y * srcPitch],rowBytes );
+		UploadSysBuffer();
+		isSysBufferChanged = false;
 	}
-	// release the adapter memory
-	pImmediateContext->Unmap( pSysBufferTexture.Get(),0u );
 
 	// render offscreen scene texture to back buffer
 	pImmediateContext->IASetInputLayout( pInputLayout.Get() );
@@ -301,38 +289,29 @@ void Graphics::EndFrame()
 	}
 }
 
-void Graphics::BeginFrame()
+void Graphics::UploadSysBuffer()
 {
-	// clear the sysbuffer
-	memset( pSysBuffer,0u,sizeof( Color ) * Graphics::ScreenHeight * Graphics::ScreenWidth );
-}
-
-RectI Graphics::GetRect() const
-{
-	return RectI( 0,ScreenWidth,0,ScreenHeight );
-}
-
-void Graphics::PutPixel( int x,int y,Color c )
-{
-	assert( x >= 0 );
-	assert( x < int( Graphics::ScreenWidth ) );
-	assert( y >= 0 );
-	assert( y < int( Graphics::ScreenHeight ) );
-	pSysBuffer[Graphics::ScreenWidth * y + x] = c;
-}
+	HRESULT hr;
 
-void Graphics::DrawRect( int x0,int y0,int x1,int y1,Color c )
-{
-	for( int y = y0; y < y1; ++y )
+	// lock and map the adapter memory for copying over the sysbuffer
+	if( FAILED( hr = pImmediateContext->Map( pSysBufferTexture.Get(),0u,
+		D3D11_MAP_WRITE_DISCARD,0u,&mappedSysBufferTexture ) ) )
 	{
-		for( int x = x0; x < x1; ++x )
-		{
-			PutPixel( x,y,c );
-		}
+		throw CHILI_GFX_EXCEPTION( hr,L"Mapping sysbuffer" );
 	}
+	// setup parameters for copy operation
+	Color* pDst = reinterpret_cast<Color*>(mappedSysBufferTexture.pData );
+	const size_t dstPitch = mappedSysBufferTexture.RowPitch / sizeof( Color );
+	const size_t rowBytes = Graphics::ScreenWidth * sizeof( Color );
+	// perform the copy line-by-line
+	for( int y = 0; y < Graphics::ScreenHeight; y++ )
+	{
+		memcpy( &pDst[ y * dstPitch ],sysBuffer.GetRow( y ),rowBytes );
+	}
+	// release the adapter memory
+	pImmediateContext->Unmap( pSysBufferTexture.Get(),0u );
 }
 
-
 //////////////////////////////////////////////////
 //           Graphics Exception
 Graphics::Exception::Exception( HRESULT hr,const std::wstring& note,const wchar_t* file,unsigned int line )
@@ -19,16 +19,25 @@
 *	along with The Chili DirectX Framework.  If not, see <http://www.gnu.org/licenses/>.  *
 ******************************************************************************************/
 #pragma once
+#if defined( _WIN32 )
 #include "ChiliWin.h"
 #include <d3d11.h>
 #include <wrl.h>
 #include "ChiliException.h"
+#endif
 #include "Colors.h"
 #include "RectI.h"
+#include "Surface.h"
+#include <string>
 
+// Draws into a sysbuffer in memory and presents it through D3D11 on Windows
+// (Graphics.cpp). Constructed without a window it is headless: frames stay in
+// memory, where they can be read back or saved, which is all there is on
+// other platforms (the sysbuffer operations are in GraphicsBuffer.cpp).
 class Graphics
 {
 public:
+#if defined( _WIN32 )
 	class Exception : public ChiliException
 	{
 	public:
@@ -49,6 +58,10 @@ private:
 	};
 public:
 	Graphics( class HWNDKey& key );
+#endif
+public:
+	// headless: EndFrame presents nothing and the frame stays in memory
+	Graphics();
 	Graphics( const Graphics& ) = delete;
 	Graphics& operator=( const Graphics& ) = delete;
 	void EndFrame();
@@ -56,15 +69,32 @@ public:
 	RectI GetRect() const;
 	void PutPixel( int x,int y,int r,int g,int b )
 	{
-		PutPixel( x,y,{ unsigned char( r ),unsigned char( g ),unsigned char( b ) } );
+		PutPixel( x,y,{ static_cast<unsigned char>( r ),static_cast<unsigned char>( g ),static_cast<unsigned char>( b ) } );
 	}
 	void PutPixel( int x,int y,Color c );
+	// copies count pixels to the row starting at (x,y); the run must be on screen
+	void PutPixels( int x,int y,const Color* pColors,int count );
+	// the rectangle is clipped to the screen
 	void DrawRect( int x0,int y0,int x1,int y1,Color c );
 	void DrawRect( const RectI& rect,Color c )
 	{
 		DrawRect( rect.left,rect.top,rect.right,rect.bottom,c );
 	}
+	// copies srcRect of s with its top left corner at (x,y), clipped to clip
+	// and the screen; with a chroma, pixels of that colour are left out
+	void DrawSprite( int x,int y,const Surface& s );
+	void DrawSprite( int x,int y,const RectI& srcRect,const RectI& clip,const Surface& s );
+	void DrawSprite( int x,int y,const RectI& srcRect,const RectI& clip,const Surface& s,Color chroma );
+	bool IsHeadless() const;
+	// the frame drawn so far
+	const Surface& GetFrame() const;
+	// see Surface::Save; false if the file could not be written
+	bool SaveFrame( const std::string& path ) const;
 	~Graphics();
+private:
+#if defined( _WIN32 )
+	// copies the sysbuffer to the texture the frame is drawn from
+	void UploadSysBuffer();
 private:
 	Microsoft::WRL::ComPtr<IDXGISwapChain>				pSwapChain;
 	Microsoft::WRL::ComPtr<ID3D11Device>				pDevice;
@@ -78,7 +108,11 @@ private:
 	Microsoft::WRL::ComPtr<ID3D11InputLayout>			pInputLayout;
 	Microsoft::WRL::ComPtr<ID3D11SamplerState>			pSamplerState;
 	D3D11_MAPPED_SUBRESOURCE							mappedSysBufferTexture;
-	Color*                                              pSysBuffer = nullptr;
+#endif
+	Surface												sysBuffer;
+	bool												isHeadless = false;
+	// set by every write to the sysbuffer since the last upload
+	bool												isSysBufferChanged = true;
 public:
 	static constexpr int ScreenWidth = 800;
 	static constexpr int ScreenHeight = 600;
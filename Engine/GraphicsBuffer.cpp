@@ -0,0 +1,98 @@
+// The sysbuffer half of Graphics: drawing into the frame in memory, which is
+// the same with and without a window. Graphics.cpp presents the frame through
+// D3D11 on Windows; elsewhere Graphics is always headless and the frame is
+// only read back or saved.
+#include "Graphics.h"
+#include "SpanFill.h"
+#include <algorithm>
+#include <assert.h>
+
+Graphics::Graphics()
+	:
+	sysBuffer( Graphics::ScreenWidth,Graphics::ScreenHeight ),
+	isHeadless( true )
+{}
+
+void Graphics::BeginFrame()
+{
+	// clear the sysbuffer (streaming stores, it is drawn over before it is read)
+	SpanFill::Clear( sysBuffer.GetRow( 0 ),size_t( sysBuffer.GetPitch() ) * Graphics::ScreenHeight,Colors::Black );
+	isSysBufferChanged = true;
+}
+
+RectI Graphics::GetRect() const
+{
+	return RectI( 0,ScreenWidth,0,ScreenHeight );
+}
+
+void Graphics::PutPixel( int x,int y,Color c )
+{
+	assert( x >= 0 );
+	assert( x < int( Graphics::ScreenWidth ) );
+	assert( y >= 0 );
+	assert( y < int( Graphics::ScreenHeight ) );
+	sysBuffer.PutPixel( x,y,c );
+	isSysBufferChanged = true;
+}
+
+void Graphics::PutPixels( int x,int y,const Color* pColors,int count )
+{
+	assert( x >= 0 );
+	assert( count >= 0 );
+	assert( x + count <= int( Graphics::ScreenWidth ) );
+	assert( y >= 0 );
+	assert( y < int( Graphics::ScreenHeight ) );
+	std::copy_n( pColors,count,sysBuffer.GetRow( y ) + x );
+	isSysBufferChanged = true;
+}
+
+void Graphics::DrawRect( int x0,int y0,int x1,int y1,Color c )
+{
+	// clipped once, then filled row by row with vector stores
+	sysBuffer.DrawRect( RectI( x0,x1,y0,y1 ),c );
+	isSysBufferChanged = true;
+}
+
+void Graphics::DrawSprite( int x,int y,const Surface& s )
+{
+	DrawSprite( x,y,s.GetRect(),GetRect(),s );
+}
+
+void Graphics::DrawSprite( int x,int y,const RectI& srcRect,const RectI& clip,const Surface& s )
+{
+	sysBuffer.Copy( s,srcRect,{ x,y },clip );
+	isSysBufferChanged = true;
+}
+
+void Graphics::DrawSprite( int x,int y,const RectI& srcRect,const RectI& clip,const Surface& s,Color chroma )
+{
+	sysBuffer.CopyKeyed( s,srcRect,{ x,y },clip,chroma );
+	isSysBufferChanged = true;
+}
+
+
+bool Graphics::IsHeadless() const
+{
+	return isHeadless;
+}
+
+const Surface& Graphics::GetFrame() const
+{
+	return sysBuffer;
+}
+
+bool Graphics::SaveFrame( const std::string& path ) const
+{
+	return sysBuffer.Save( path );
+}
+
+#if !defined( _WIN32 )
+Graphics::~Graphics()
+{}
+
+void Graphics::EndFrame()
+{
+	// nothing to present to; the frame stays in sysBuffer until the next one
+	isSysBufferChanged = false;
+}
+#endif
@@ -0,0 +1,495 @@
+#include "LinearSolver.h"
+#include <assert.h>
+#include <algorithm>
+
+namespace
+{
+	int64_t GreatestCommonDivisor(int64_t a, int64_t b)
+	{
+		while (b != 0)
+		{
+			const int64_t remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+		return a;
+	}
+
+	int64_t Abs(int64_t value)
+	{
+		return value < 0 ? -value : value;
+	}
+}
+
+constexpr int8_t LinearSolver::unknown;
+constexpr int64_t LinearSolver::maxCoefficient;
+
+LinearSolver::LinearSolver(const MineField& field)
+	:
+	field(field),
+	width(field.GetWidth()),
+	height(field.GetHeight()),
+	knownSafe(field.GetWidth(), field.GetHeight()),
+	knownMine(field.GetWidth(), field.GetHeight())
+{
+	Rebuild();
+}
+
+void LinearSolver::Update(const std::vector<MineField::TileRun>& changedRuns)
+{
+	// cells first: revealed tiles are safe and flags count as mines; a tile
+	// that went back to hidden was unflagged, which no row can take back
+	for (const MineField::TileRun& run : changedRuns)
+	{
+		for (Vei2 pos = { run.xStart, run.y }; pos.x <= run.xEnd; pos.x++)
+		{
+			const MineField::Tile tile = field.TileAt(pos);
+			const auto it = cellIndex.find(static_cast<long long>(pos.y) * width + pos.x);
+			if (tile.IsHidden() || (tile.IsFlagged() && it != cellIndex.end() && cellValues[it->second] == 0))
+			{
+				Rebuild();
+				return;
+			}
+			if (it != cellIndex.end())
+			{
+				Fix(it->second, tile.IsFlagged() ? 1 : 0, false);
+			}
+		}
+	}
+	// then the rows of the numbers revealed
+	for (const MineField::TileRun& run : changedRuns)
+	{
+		for (Vei2 pos = { run.xStart, run.y }; pos.x <= run.xEnd; pos.x++)
+		{
+			if (field.TileAt(pos).IsRevealed())
+			{
+				AddNumber(pos);
+			}
+		}
+	}
+	Propagate();
+}
+
+bool LinearSolver::IsKnownSafe(const Vei2& gridPos) const
+{
+	return knownSafe.Get(gridPos.x, gridPos.y);
+}
+
+bool LinearSolver::IsKnownMine(const Vei2& gridPos) const
+{
+	return knownMine.Get(gridPos.x, gridPos.y);
+}
+
+std::vector<Vei2> LinearSolver::TakeSafeTiles()
+{
+	// drop the ones revealed in the meantime
+	std::vector<Vei2> tiles;
+	for (const Vei2& pos : newSafeTiles)
+	{
+		if (!field.TileAt(pos).IsRevealed())
+		{
+			tiles.push_back(pos);
+		}
+	}
+	newSafeTiles.clear();
+	return tiles;
+}
+
+std::vector<Vei2> LinearSolver::TakeMineTiles()
+{
+	std::vector<Vei2> tiles;
+	tiles.swap(newMineTiles);
+	return tiles;
+}
+
+int LinearSolver::GetRowCount() const
+{
+	return nRows;
+}
+
+int LinearSolver::GetDroppedRowCount() const
+{
+	return nDroppedRows;
+}
+
+void LinearSolver::Rebuild()
+{
+	cellIndex.clear();
+	cellPositions.clear();
+	cellValues.clear();
+	pivotRows.clear();
+	cellRows.clear();
+	rows.clear();
+	freeRows.clear();
+	substitutionQueue.clear();
+	knownSafe.ClearAll();
+	knownMine.ClearAll();
+	newSafeTiles.clear();
+	newMineTiles.clear();
+	nRows = 0;
+	field.GetConstraintTiles().ForEach([this](const Vei2& pos)
+	{
+		AddNumber(pos);
+	});
+	Propagate();
+}
+
+int LinearSolver::GetCell(const Vei2& gridPos)
+{
+	const auto inserted = cellIndex.emplace(static_cast<long long>(gridPos.y) * width + gridPos.x, int(cellPositions.size()));
+	if (inserted.second)
+	{
+		cellPositions.push_back(gridPos);
+		cellValues.push_back(unknown);
+		pivotRows.push_back(-1);
+		cellRows.emplace_back();
+	}
+	return inserted.first->second;
+}
+
+void LinearSolver::Fix(int cell, int8_t value, bool isDeduced)
+{
+	// a second, different value means wrong flags; the first one stands
+	if (cellValues[cell] != unknown) return;
+	cellValues[cell] = value;
+	substitutionQueue.push_back(cell);
+	if (isDeduced)
+	{
+		const Vei2& pos = cellPositions[cell];
+		if (value == 0)
+		{
+			knownSafe.Set(pos.x, pos.y);
+			newSafeTiles.push_back(pos);
+		}
+		else
+		{
+			knownMine.Set(pos.x, pos.y);
+			newMineTiles.push_back(pos);
+		}
+	}
+}
+
+void LinearSolver::AddNumber(const Vei2& gridPos)
+{
+	const int nNeighbourMines = field.TileAt(gridPos).GetNeighbourMineCount();
+	// a revealed mine: the game is lost and the tile says nothing
+	if (nNeighbourMines < 0) return;
+
+	Row row;
+	row.value = nNeighbourMines;
+	for (Vei2 pos = { std::max(0, gridPos.x - 1), std::max(0, gridPos.y - 1) }; pos.y <= std::min(height - 1, gridPos.y + 1); pos.y++)
+	{
+		for (pos.x = std::max(0, gridPos.x - 1); pos.x <= std::min(width - 1, gridPos.x + 1); pos.x++)
+		{
+			const MineField::Tile tile = field.TileAt(pos);
+			if (tile.IsFlagged())
+			{
+				row.value--;
+			}
+			else if (tile.IsHidden())
+			{
+				const int cell = GetCell(pos);
+				if (cellValues[cell] == unknown)
+				{
+					row.terms.push_back({ cell, 1 });
+				}
+				else
+				{
+					row.value -= cellValues[cell];
+				}
+			}
+		}
+	}
+	if (row.terms.empty()) return;
+	std::sort(row.terms.begin(), row.terms.end(), [](const Term& a, const Term& b)
+	{
+		return a.cell < b.cell;
+	});
+	AddRow(std::move(row));
+}
+
+void LinearSolver::AddRow(Row row)
+{
+	int r;
+	if (freeRows.empty())
+	{
+		r = int(rows.size());
+		rows.push_back(std::move(row));
+	}
+	else
+	{
+		r = freeRows.back();
+		freeRows.pop_back();
+		rows[r] = std::move(row);
+	}
+	nRows++;
+	for (const Term& term : rows[r].terms)
+	{
+		cellRows[term.cell].push_back(r);
+	}
+
+	// reduce by the existing pivots; a pivot row mentions no other pivot
+	// cell, so one pass over the pivots the row started with is enough
+	std::vector<int> pivotCells;
+	for (const Term& term : rows[r].terms)
+	{
+		if (pivotRows[term.cell] >= 0)
+		{
+			pivotCells.push_back(term.cell);
+		}
+	}
+	for (int cell : pivotCells)
+	{
+		if (!Eliminate(r, pivotRows[cell], cell)) return;
+	}
+	Pivot(r);
+}
+
+void LinearSolver::Pivot(int r)
+{
+	// the cell in the fewest rows costs the fewest eliminations and the
+	// least fill-in; cells already fixed are about to be substituted, so
+	// they only get picked when nothing else is left
+	Row& row = rows[r];
+	int pivot = -1;
+	size_t pivotRowCount = 0;
+	for (const Term& term : row.terms)
+	{
+		const size_t rowCount = cellValues[term.cell] == unknown ? cellRows[term.cell].size() : size_t(-1);
+		if (pivot < 0 || rowCount < pivotRowCount)
+		{
+			pivot = term.cell;
+			pivotRowCount = rowCount;
+		}
+	}
+	assert(pivot >= 0 && pivotRows[pivot] < 0);
+	if (FindTerm(row, pivot)->coefficient < 0)
+	{
+		for (Term& term : row.terms)
+		{
+			term.coefficient = -term.coefficient;
+		}
+		row.value = -row.value;
+	}
+	row.pivot = pivot;
+	pivotRows[pivot] = r;
+
+	std::vector<int> others;
+	others.swap(cellRows[pivot]);
+	cellRows[pivot].push_back(r);
+	for (int other : others)
+	{
+		if (other != r && FindTerm(rows[other], pivot) != nullptr && Eliminate(other, r, pivot))
+		{
+			CheckRow(other);
+		}
+	}
+	CheckRow(r);
+}
+
+bool LinearSolver::Eliminate(int target, int source, int cell)
+{
+	// target = sourceFactor * target - targetFactor * source, with
+	// sourceFactor > 0 so a pivot in target keeps its sign
+	Row& targetRow = rows[target];
+	const Row& sourceRow = rows[source];
+	const int64_t sourceFactor = FindTerm(sourceRow, cell)->coefficient;
+	const int64_t targetFactor = FindTerm(targetRow, cell)->coefficient;
+	assert(sourceFactor > 0);
+	std::vector<Term> terms;
+	terms.reserve(targetRow.terms.size() + sourceRow.terms.size());
+	auto t = targetRow.terms.begin();
+	auto s = sourceRow.terms.begin();
+	while (t != targetRow.terms.end() || s != sourceRow.terms.end())
+	{
+		if (s == sourceRow.terms.end() || (t != targetRow.terms.end() && t->cell < s->cell))
+		{
+			terms.push_back({ t->cell, sourceFactor * t->coefficient });
+			++t;
+		}
+		else if (t == targetRow.terms.end() || s->cell < t->cell)
+		{
+			terms.push_back({ s->cell, -targetFactor * s->coefficient });
+			cellRows[s->cell].push_back(target);
+			++s;
+		}
+		else
+		{
+			const int64_t coefficient = sourceFactor * t->coefficient - targetFactor * s->coefficient;
+			if (coefficient != 0)
+			{
+				terms.push_back({ t->cell, coefficient });
+			}
+			++t;
+			++s;
+		}
+	}
+	targetRow.terms.swap(terms);
+	targetRow.value = sourceFactor * targetRow.value - targetFactor * sourceRow.value;
+
+	if (!Normalize(targetRow))
+	{
+		nDroppedRows++;
+		DropRow(target);
+		return false;
+	}
+	// a combination of the others: nothing new (or, with wrong flags, 0 = 1)
+	if (targetRow.terms.empty())
+	{
+		DropRow(target);
+		return false;
+	}
+	return true;
+}
+
+bool LinearSolver::Normalize(Row& row) const
+{
+	int64_t divisor = Abs(row.value);
+	for (const Term& term : row.terms)
+	{
+		divisor = GreatestCommonDivisor(Abs(term.coefficient), divisor);
+	}
+	if (divisor > 1)
+	{
+		for (Term& term : row.terms)
+		{
+			term.coefficient /= divisor;
+		}
+		row.value /= divisor;
+	}
+	if (Abs(row.value) >= maxCoefficient) return false;
+	return std::all_of(row.terms.begin(), row.terms.end(), [](const Term& term)
+	{
+		return Abs(term.coefficient) < maxCoefficient;
+	});
+}
+
+void LinearSolver::DropRow(int r)
+{
+	Row& row = rows[r];
+	if (row.pivot >= 0)
+	{
+		pivotRows[row.pivot] = -1;
+	}
+	row.terms.clear();
+	row.value = 0;
+	row.pivot = -1;
+	freeRows.push_back(r);
+	nRows--;
+}
+
+void LinearSolver::CheckRow(int r)
+{
+	// with the other cells free, cell j's coefficient c must fit between
+	// the least (lo) and most (hi) the row can add up to
+	const Row& row = rows[r];
+	int64_t lo = 0;
+	int64_t hi = 0;
+	for (const Term& term : row.terms)
+	{
+		(term.coefficient > 0 ? hi : lo) += term.coefficient;
+	}
+	// unsatisfiable, which only wrong flags can cause: nothing sound follows
+	if (row.value < lo || row.value > hi) return;
+	if (row.value != lo && row.value != hi)
+	{
+		// a cell is forced only if its coefficient outweighs the slack
+		const int64_t slack = std::min(row.value - lo, hi - row.value);
+		const bool isAnyForced = std::any_of(row.terms.begin(), row.terms.end(), [slack](const Term& term)
+		{
+			return Abs(term.coefficient) > slack;
+		});
+		if (!isAnyForced) return;
+	}
+	for (const Term& term : row.terms)
+	{
+		const int64_t c = term.coefficient;
+		if (c > 0)
+		{
+			if (row.value > hi - c)
+			{
+				Fix(term.cell, 1, true);
+			}
+			else if (row.value - c < lo)
+			{
+				Fix(term.cell, 0, true);
+			}
+		}
+		else
+		{
+			if (row.value < lo - c)
+			{
+				Fix(term.cell, 1, true);
+			}
+			else if (row.value - c > hi)
+			{
+				Fix(term.cell, 0, true);
+			}
+		}
+	}
+}
+
+void LinearSolver::Substitute(int cell)
+{
+	const int64_t value = cellValues[cell];
+	// eliminations below can copy the cell into rows already visited, so
+	// go round until none mentions it
+	while (!cellRows[cell].empty())
+	{
+		std::vector<int> rowsOfCell;
+		rowsOfCell.swap(cellRows[cell]);
+		for (int r : rowsOfCell)
+		{
+			Row& row = rows[r];
+			const auto it = std::lower_bound(row.terms.begin(), row.terms.end(), cell, [](const Term& term, int c)
+			{
+				return term.cell < c;
+			});
+			if (it == row.terms.end() || it->cell != cell) continue;
+			row.value -= it->coefficient * value;
+			row.terms.erase(it);
+			const bool wasPivot = row.pivot == cell;
+			if (wasPivot)
+			{
+				row.pivot = -1;
+				pivotRows[cell] = -1;
+			}
+			if (row.terms.empty())
+			{
+				DropRow(r);
+			}
+			else if (!Normalize(row))
+			{
+				nDroppedRows++;
+				DropRow(r);
+			}
+			else if (wasPivot)
+			{
+				Pivot(r);
+			}
+			else
+			{
+				CheckRow(r);
+			}
+		}
+	}
+}
+
+void LinearSolver::Propagate()
+{
+	while (!substitutionQueue.empty())
+	{
+		const int cell = substitutionQueue.back();
+		substitutionQueue.pop_back();
+		Substitute(cell);
+	}
+}
+
+const LinearSolver::Term* LinearSolver::FindTerm(const Row& row, int cell)
+{
+	const auto it = std::lower_bound(row.terms.begin(), row.terms.end(), cell, [](const Term& term, int c)
+	{
+		return term.cell < c;
+	});
+	return it != row.terms.end() && it->cell == cell ? &*it : nullptr;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "Vei2.h"
+#include "BitGrid.h"
+#include "MineField.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Deductions from the revealed numbers taken as one linear system over the
+// frontier: every number is a row "sum of its hidden neighbours = number
+// minus flags", kept in reduced row echelon form with exact integer
+// coefficients. A row whose right-hand side equals the least or the most its
+// coefficients can add up to forces every cell in it, which catches chains
+// and long-range combinations the pairwise rules of MineSolver cannot see.
+// Rows are added and cells substituted as the game goes, so a reveal only
+// reduces the new rows and the rows sharing their cells; unflagging a tile
+// (the only move that takes information back) rebuilds the system. Like
+// MineSolver, call Update with MineField::GetLastChangedRuns() after every
+// reveal or flag click.
+// Rows are sparse (cell, coefficient) lists rather than dense bitsets over
+// the frontier: a bitset row can only hold coefficients mod 2, and parity
+// loses the magnitudes most forced cells come from (x1+x2=1, x2+x3=1,
+// x1+x3=2 forces all three but has no GF(2) consequence). Integer rows keep
+// them, and under the sparsest-cell pivot choice frontier rows stay a few
+// dozen terms long where a dense row would span every frontier cell.
+class LinearSolver
+{
+public:
+	LinearSolver(const MineField& field);
+	void Update(const std::vector<MineField::TileRun>& changedRuns);
+	bool IsKnownSafe(const Vei2& gridPos) const;
+	bool IsKnownMine(const Vei2& gridPos) const;
+	// deductions made since the last call, for the caller to reveal / flag
+	std::vector<Vei2> TakeSafeTiles();
+	std::vector<Vei2> TakeMineTiles();
+	// rows currently in the system, and rows dropped because reducing them
+	// overflowed (rare; they only cost deductions, never soundness)
+	int GetRowCount() const;
+	int GetDroppedRowCount() const;
+private:
+	struct Term
+	{
+		int cell;
+		int64_t coefficient;
+	};
+	// terms sorted by cell; a pivot row has a positive coefficient on its
+	// pivot cell, and no other row mentions that cell
+	struct Row
+	{
+		std::vector<Term> terms;
+		int64_t value = 0;
+		int pivot = -1;
+	};
+	static constexpr int8_t unknown = -1;
+	// coefficients are kept below this so the products in a reduction step
+	// cannot overflow 64 bits
+	static constexpr int64_t maxCoefficient = int64_t(1) << 30;
+private:
+	void Rebuild();
+	int GetCell(const Vei2& gridPos);
+	// queues a cell's value; its rows are rewritten by Propagate
+	void Fix(int cell, int8_t value, bool isDeduced);
+	void AddNumber(const Vei2& gridPos);
+	void AddRow(Row row);
+	// makes row r the pivot row of its sparsest cell and eliminates that
+	// cell from every other row
+	void Pivot(int r);
+	// target -= source scaled to cancel cell; false (target dropped) on overflow
+	bool Eliminate(int target, int source, int cell);
+	// divides out the common factor; false if the row got too big to keep
+	bool Normalize(Row& row) const;
+	void DropRow(int r);
+	void CheckRow(int r);
+	void Substitute(int cell);
+	void Propagate();
+	static const Term* FindTerm(const Row& row, int cell);
+private:
+	const MineField& field;
+	int width;
+	int height;
+	// one cell per hidden tile a number has ever mentioned
+	std::unordered_map<long long, int> cellIndex;
+	std::vector<Vei2> cellPositions;
+	std::vector<int8_t> cellValues;
+	std::vector<int> pivotRows;
+	// rows that mention each cell; may hold rows that no longer do
+	std::vector<std::vector<int>> cellRows;
+	std::vector<Row> rows;
+	std::vector<int> freeRows;
+	std::vector<int> substitutionQueue;
+	BitGrid knownSafe;
+	BitGrid knownMine;
+	std::vector<Vei2> newSafeTiles;
+	std::vector<Vei2> newMineTiles;
+	int nRows = 0;
+	int nDroppedRows = 0;
+};
@@ -1,220 +1,152 @@
-#include "Minefield.h"
-#include "Vei2.h"
-#include "SpriteCodex.h"
-#include <random>
+#include "MineField.h"
+#include "NeighbourCountKernel.h"
+#include "MinePlacement.h"
 #include <assert.h>
 #include <algorithm>
 
-void MineField::Tile::SpawnMine()
+MineField::MineField(int width, int height, int nMines, uint64_t seed, int nThreads)
+	:
+	width(width),
+	height(height),
+	nMines(nMines),
+	seed(seed),
+	nThreads(nThreads),
+	nSafeTilesLeft(static_cast<long long>(width) * height - nMines),
+	mines(width, height),
+	revealed(width, height),
+	flagged(width, height),
+	neighbourCounts(width, height),
+	frontier(width, height),
+	constraintTiles(width, height),
+	dirtyWordBits((size_t(revealed.GetWordsPerRow()) * height + 63) / 64, 0u)
 {
-	assert(!hasMine);
-	hasMine = true;
+	assert(nMines > 0);
+	assert(size_t(nMines) < size_t(width) * height);
 }
 
-void MineField::Tile::Draw(const Vei2& screenPos, GameState gameState, Graphics& gfx) const
+void MineField::Generate(const Vei2& safePos)
 {
-	if (gameState == GameState::Playing)
-	{
-		switch (state)
-		{
-		case State::Hidden:
-			SpriteCodex::DrawTileButton(screenPos, gfx);
-			break;
-		case State::Flagged:
-			SpriteCodex::DrawTileButton(screenPos, gfx);
-			SpriteCodex::DrawTileFlag(screenPos, gfx);
-			break;
-		case State::Revealed:
-			if (hasMine)
-			{
+	assert(safePos.x >= 0 && safePos.x < width);
+	assert(safePos.y >= 0 && safePos.y < height);
+	if (isGenerated) return;
 
-				SpriteCodex::DrawTileBomb(screenPos, gfx);
-			}
-			else
-			{
-				SpriteCodex::DrawTileNumber(screenPos, nNeighbourMines, gfx);
-			}
-			break;
-		}
-	}
-	else
+	// a single placement pass with the safe tiles excluded, never a re-roll
+	std::vector<Vei2> safeTiles;
+	for (Vei2 pos = { std::max(0, safePos.x - 1), std::max(0, safePos.y - 1) }; pos.y <= std::min(height - 1, safePos.y + 1); pos.y++)
 	{
-		switch (state)
+		for (pos.x = std::max(0, safePos.x - 1); pos.x <= std::min(width - 1, safePos.x + 1); pos.x++)
 		{
-		case State::Hidden:
-			if (hasMine)
-			{
-				SpriteCodex::DrawTileBomb(screenPos, gfx);
-			}
-			else
-			{
-				SpriteCodex::DrawTileNumber(screenPos, nNeighbourMines, gfx);
-			}
-			break;
-		case State::Flagged:
-			if (hasMine)
-			{
-				SpriteCodex::DrawTileBomb(screenPos, gfx);
-				SpriteCodex::DrawTileFlag(screenPos, gfx);
-			}
-			else
-			{
-				SpriteCodex::DrawTileNumber(screenPos, nNeighbourMines, gfx);
-				SpriteCodex::DrawTileCross(screenPos, gfx);
-			}
-			break;
-		case State::Revealed:
-			if (hasMine)
-			{
-				SpriteCodex::DrawTileBombRed(screenPos, gfx);
-			}
-			else
-			{
-				SpriteCodex::DrawTileNumber(screenPos, nNeighbourMines, gfx);
-			}
-			break;
+			safeTiles.push_back(pos);
 		}
 	}
-
-}
-
-void MineField::Tile::Reveal()
-{
-	assert(state == State::Hidden);
-	state = State::Revealed;
-}
-
-bool MineField::Tile::IsRevealed() const
-{
-	return state == State::Revealed;
-}
-
-bool MineField::Tile::IsHidden() const
-{
-	return state == State::Hidden;
-}
-
-bool MineField::Tile::IsFlagged() const
-{
-	return state == State::Flagged;
-}
-
-bool MineField::Tile::HasMine() const
-{
-	return hasMine;
-}
-
-int MineField::Tile::GetNeighbourMineCount()
-{
-	return nNeighbourMines;
-}
-
-void MineField::Tile::ToggleFlag()
-{
-	assert(!IsRevealed());
-	if (state == State::Hidden)
+	if (static_cast<long long>(width) * height - static_cast<long long>(safeTiles.size()) < nMines)
 	{
-		state = State::Flagged;
+		safeTiles.assign(1, safePos);
 	}
-	else
+
+	MinePlacement::Place(mines, nMines, seed, nThreads, safeTiles);
+	NeighbourCountKernel::Compute(mines, neighbourCounts, NeighbourCountKernel::Path::Auto, nThreads);
+#ifndef NDEBUG
+	// the bulk kernel must agree bit for bit with the per-tile count
+	for (int y = 0; y < height; y++)
 	{
-		state = State::Hidden;
+		for (int x = 0; x < width; x++)
+		{
+			assert(mines.Get(x, y) || neighbourCounts.Get(x, y) == CountNeighboursMines({ x, y }));
+		}
 	}
-}
-
-void MineField::Tile::SetNeighbourMineCount(int mineCount)
-{
-	assert(nNeighbourMines == -1);
-	assert(mineCount >= 0 && mineCount <= 8);
-	nNeighbourMines = mineCount;
-}
-
-MineField::MineField(int nMines)
-{
-	assert(nMines > 0);
-	assert(nMines < width * height);
-
-	std::random_device rd;
-	std::mt19937 rng(rd());
-	std::uniform_int_distribution<int> xDist(0, width - 1);
-	std::uniform_int_distribution<int> yDist(0, height - 1);
-
-	for (int i = 0; i < nMines; i++)
+#endif
+	// flags may have been placed before the first reveal
+	for (int y = 0; y < height; y++)
 	{
-		Vei2 spawnPos;
-		do
+		for (int i = 0; i < flagged.GetWordsPerRow(); i++)
 		{
-			spawnPos = { xDist(rng), yDist(rng) };
-		} while (TileAt(spawnPos).HasMine());
-		TileAt(spawnPos).SpawnMine();
+			nSafeTilesFlagged += BitGrid::Popcount(flagged.Row(y)[i] & ~mines.Row(y)[i]);
+		}
 	}
-
-	for (int x = 0; x < width; x++)
+	if (isOpeningIndexEnabled)
 	{
+		openingIndex.Build(mines, neighbourCounts);
+		openingFlagCounts.assign(openingIndex.GetOpeningCount(), 0);
+		isOpeningSplit.assign(openingIndex.GetOpeningCount(), 0);
+		// flags may have been placed before the first reveal
 		for (int y = 0; y < height; y++)
 		{
-			Tile& tile = TileAt({ x, y });
-			if (!tile.HasMine())
+			for (int i = 0; i < flagged.GetWordsPerRow(); i++)
 			{
-				tile.SetNeighbourMineCount(CountNeighboursMines({x, y}));
+				for (uint64_t bits = flagged.Row(y)[i] & ~mines.Row(y)[i]; bits != 0; bits &= bits - 1)
+				{
+					const int x = i * 64 + BitGrid::CountTrailingZeros(bits);
+					if (neighbourCounts.Get(x, y) == 0)
+					{
+						openingFlagCounts[openingIndex.FindOpening({ x, y })]++;
+					}
+				}
 			}
 		}
 	}
-
+	isGenerated = true;
 }
 
-void MineField::Draw(Graphics & gfx) const
+bool MineField::IsGenerated() const
 {
-	DrawBorder(gfx);
-	gfx.DrawRect(GetRect(), SpriteCodex::baseColor);
-	const Vei2 padding(xPadding, yPadding);
-	for (Vei2 gridPos = { 0,0 }; gridPos.y < height; gridPos.y++)
-	{
-		for (gridPos.x = 0; gridPos.x < width; gridPos.x++)
-		{
-			TileAt(gridPos).Draw(gridPos * SpriteCodex::tileSize + padding, gameState, gfx);
-		}
-	}
-
-	if (gameState == GameState::Win)
-	{
-		SpriteCodex::DrawWin({Graphics::ScreenWidth / 2,
-			Graphics::ScreenHeight / 2 }, 
-			gfx);
-	}
+	return isGenerated;
 }
 
-RectI MineField::GetRect() const
+void MineField::EnableOpeningIndex()
 {
-	return RectI(xPadding, xPadding + SpriteCodex::tileSize * width, yPadding, yPadding + SpriteCodex::tileSize * height);
+	assert(!isGenerated);
+	isOpeningIndexEnabled = true;
 }
 
-bool MineField::OnRevealClick(const Vei2& screenPos)
+bool MineField::OnRevealClick(const Vei2& gridPos)
 {
 	if (gameState == GameState::Playing)
 	{
-		const Vei2 gridPos = GetGridPos(screenPos);
 		assert(gridPos.x >= 0 && gridPos.x < width);
 		assert(gridPos.y >= 0 && gridPos.y < height);
-		Tile& tile = TileAt(gridPos);
+		changedRuns.clear();
+		Generate(gridPos);
+		const Tile tile = TileAt(gridPos);
 
 		if (tile.IsHidden())
 		{
 			
 			if (tile.HasMine())
 			{
-				tile.Reveal();
+				RevealRun(gridPos.y, gridPos.x, gridPos.x);
+				UpdateIndex();
 				gameState = GameState::Lose;
 				return true;
 			}
 			else if (tile.GetNeighbourMineCount() == 0)
 			{
-				RevealAdjacentTiles(gridPos);
+				const int opening = openingIndex.IsBuilt() ? openingIndex.FindOpening(gridPos) : -1;
+				if (opening >= 0 && openingFlagCounts[opening] == 0 && !isOpeningSplit[opening])
+				{
+					RevealIndexedOpening(opening);
+				}
+				else
+				{
+					if (opening >= 0)
+					{
+						isOpeningSplit[opening] = 1;
+					}
+					RevealOpening(gridPos);
+				}
 			}
 			else
 			{
-				tile.Reveal();
-				CheckForWin();
+				RevealRun(gridPos.y, gridPos.x, gridPos.x);
+			}
+			UpdateIndex();
+
+			assert(nSafeTilesLeft == CountSafeTilesLeft());
+			// as in the original CheckForWin, a flagged safe tile does not
+			// have to be revealed
+			if (nSafeTilesLeft == nSafeTilesFlagged)
+			{
+				gameState = GameState::Win;
 			}
 
 		}
@@ -222,36 +154,112 @@ bool MineField::OnRevealClick(const Vei2& screenPos)
 	return false;
 }
 
-void MineField::OnFlagClick(const Vei2 & screenPos)
+void MineField::OnFlagClick(const Vei2 & gridPos)
 {
 	if (gameState != GameState::Playing) return;
-	const Vei2 gridPos = GetGridPos(screenPos);
 	assert(gridPos.x >= 0 && gridPos.x < width);
 	assert(gridPos.y >= 0 && gridPos.y < height);
-	Tile& tile = TileAt(gridPos);
-	if (!tile.IsRevealed())
+	changedRuns.clear();
+	if (!revealed.Get(gridPos.x, gridPos.y))
 	{
-		tile.ToggleFlag();
+		flagged.Toggle(gridPos.x, gridPos.y);
+		nFlagged += flagged.Get(gridPos.x, gridPos.y) ? 1 : -1;
+		if (isGenerated && !mines.Get(gridPos.x, gridPos.y))
+		{
+			nSafeTilesFlagged += flagged.Get(gridPos.x, gridPos.y) ? 1 : -1;
+		}
+		if (openingIndex.IsBuilt() && !mines.Get(gridPos.x, gridPos.y) && neighbourCounts.Get(gridPos.x, gridPos.y) == 0)
+		{
+			openingFlagCounts[openingIndex.FindOpening(gridPos)] += flagged.Get(gridPos.x, gridPos.y) ? 1 : -1;
+		}
+		changedRuns.push_back({ gridPos.y, gridPos.x, gridPos.x });
+		UpdateIndex();
 	}
 }
 
-MineField::Tile& MineField::TileAt(const Vei2 & gridPos)
+const std::vector<MineField::TileRun>& MineField::GetLastChangedRuns() const
+{
+	return changedRuns;
+}
+
+const TileSet& MineField::GetFrontier() const
 {
-	return field[gridPos.y * width + gridPos.x];
+	return frontier;
 }
 
-const MineField::Tile& MineField::TileAt(const Vei2 & gridPos) const
+const TileSet& MineField::GetConstraintTiles() const
 {
-	return field[gridPos.y * width + gridPos.x];
+	return constraintTiles;
 }
 
-Vei2 MineField::GetGridPos(const Vei2 & screenPos) const
+const BitGrid& MineField::GetMines() const
 {
-	const Vei2 padding(xPadding, yPadding);
-	return (screenPos - padding) / SpriteCodex::tileSize;
+	return mines;
 }
 
-int MineField::CountNeighboursMines(const Vei2 & gridPos)
+const NibbleGrid& MineField::GetNeighbourCounts() const
+{
+	return neighbourCounts;
+}
+
+int MineField::GetMineCount() const
+{
+	return nMines;
+}
+
+uint64_t MineField::GetSeed() const
+{
+	return seed;
+}
+
+MineField::GameState MineField::GetGameState() const
+{
+	return gameState;
+}
+
+int MineField::GetWidth() const
+{
+	return width;
+}
+
+int MineField::GetHeight() const
+{
+	return height;
+}
+
+long long MineField::CountRevealed() const
+{
+	// a lost game has revealed exactly one mine
+	const long long nRevealed = static_cast<long long>(width) * height - nMines - nSafeTilesLeft +
+		(gameState == GameState::Lose ? 1 : 0);
+	assert(nRevealed == revealed.Count());
+	return nRevealed;
+}
+
+long long MineField::CountFlagged() const
+{
+	assert(nFlagged == flagged.Count());
+	return nFlagged;
+}
+
+long long MineField::GetSafeTilesLeft() const
+{
+	return nSafeTilesLeft;
+}
+
+long long MineField::GetFlagCount() const
+{
+	return nFlagged;
+}
+
+size_t MineField::GetMemoryBytes() const
+{
+	return mines.GetMemoryBytes() + revealed.GetMemoryBytes() + flagged.GetMemoryBytes() +
+		neighbourCounts.GetMemoryBytes() + frontier.GetMemoryBytes() + constraintTiles.GetMemoryBytes() +
+		openingIndex.GetMemoryBytes() + openingFlagCounts.capacity() * sizeof(int) + isOpeningSplit.capacity();
+}
+
+int MineField::CountNeighboursMines(const Vei2 & gridPos) const
 {
 	const int xStart = std::max(0, gridPos.x - 1);
 	const int xEnd = std::min(width - 1, gridPos.x + 1);
@@ -264,7 +272,7 @@ int MineField::CountNeighboursMines(const Vei2 & gridPos)
 	{
 		for (int y = yStart; y <= yEnd; y++)
 		{
-			if (TileAt({ x, y }).HasMine())
+			if (mines.Get(x, y))
 			{
 				mineCount++;
 			}
@@ -275,55 +283,231 @@ int MineField::CountNeighboursMines(const Vei2 & gridPos)
 	return mineCount;
 }
 
-void MineField::DrawBorder(Graphics & gfx) const
+long long MineField::CountSafeTilesLeft() const
 {
-	gfx.DrawRect(xPadding - SpriteCodex::tileSize, 
-		yPadding - SpriteCodex::tileSize, 
-		xPadding + width * SpriteCodex::tileSize + SpriteCodex::tileSize, 
-		yPadding + height * SpriteCodex::tileSize + SpriteCodex::tileSize, borderColor);
+	// padding bits are zero in every plane so they are masked off per row
+	const int wordsPerRow = mines.GetWordsPerRow();
+	const uint64_t tailMask = mines.GetTailMask();
+	long long count = 0;
+	for (int y = 0; y < height; y++)
+	{
+		const uint64_t* mineRow = mines.Row(y);
+		const uint64_t* revealedRow = revealed.Row(y);
+		for (int i = 0; i < wordsPerRow; i++)
+		{
+			const uint64_t validMask = i == wordsPerRow - 1 ? tailMask : ~uint64_t(0);
+			count += BitGrid::Popcount(~(mineRow[i] | revealedRow[i]) & validMask);
+		}
+	}
+	return count;
 }
 
-void MineField::CheckForWin()
+void MineField::RevealTile(int x, int y)
 {
-	for (int y = 0; y < height; y++)
+	assert(!revealed.Get(x, y));
+	revealed.Set(x, y);
+	if (!mines.Get(x, y))
 	{
-		for (int x = 0; x < width; x++)
-		{
-			const Vei2 gridPos(x, y);
-			if (TileAt(gridPos).IsHidden() && !TileAt(gridPos).HasMine())
-			{
-				return;
+		nSafeTilesLeft--;
+	}
+}
 
-			}
-		}
+void MineField::RevealRun(int y, int xStart, int xEnd)
+{
+	for (int x = xStart; x <= xEnd; x++)
+	{
+		RevealTile(x, y);
 	}
-	gameState = GameState::Win;
+	changedRuns.push_back({ y, xStart, xEnd });
 }
 
-void MineField::RevealAdjacentTiles(const Vei2& gridPos)
+bool MineField::IsClosed(int x, int y) const
 {
-	const int xStart = std::max(0, gridPos.x - 1);
-	const int xEnd = std::min(width - 1, gridPos.x + 1);
-	const int yStart = std::max(0, gridPos.y - 1);
-	const int yEnd = std::min(height - 1, gridPos.y + 1);
+	return !revealed.Get(x, y) && !flagged.Get(x, y);
+}
 
-	Tile& tile = TileAt(gridPos);
+uint64_t MineField::GetClosedWord(int y, int wordIndex) const
+{
+	const int wordsPerRow = revealed.GetWordsPerRow();
+	if (y < 0 || y >= height || wordIndex < 0 || wordIndex >= wordsPerRow) return 0u;
+	const uint64_t validMask = wordIndex == wordsPerRow - 1 ? revealed.GetTailMask() : ~uint64_t(0);
+	return ~(revealed.Row(y)[wordIndex] | flagged.Row(y)[wordIndex]) & validMask;
+}
 
-	if (!tile.IsHidden() || tile.HasMine() || tile.IsFlagged()) return;
-	else
+uint64_t MineField::GetRevealedWord(int y, int wordIndex) const
+{
+	if (y < 0 || y >= height || wordIndex < 0 || wordIndex >= revealed.GetWordsPerRow()) return 0u;
+	return revealed.Row(y)[wordIndex];
+}
+
+void MineField::RevealOpening(const Vei2& gridPos)
+{
+	// Scanline fill: each seed grows into the widest run of closed zero tiles
+	// on its row, then the rows above and below are scanned once over the
+	// run's extent. Every tile around a zero is safe, so numbers found there
+	// are revealed directly and each run of closed zeros queues a single seed.
+	// Work is proportional to the opening plus its border.
+	assert(IsClosed(gridPos.x, gridPos.y) && !mines.Get(gridPos.x, gridPos.y));
+	assert(neighbourCounts.Get(gridPos.x, gridPos.y) == 0);
+
+	openingSeeds.clear();
+	openingSeeds.push_back(gridPos);
+	while (!openingSeeds.empty())
 	{
-		tile.Reveal();
-		if (tile.GetNeighbourMineCount() > 0) return;
-		for (Vei2 pos = { xStart, yStart }; pos.y <= yEnd; pos.y++)
+		const Vei2 seed = openingSeeds.back();
+		openingSeeds.pop_back();
+		// an earlier span may already have covered this seed's run
+		if (revealed.Get(seed.x, seed.y)) continue;
+
+		int xLeft = seed.x;
+		while (xLeft > 0 && IsClosed(xLeft - 1, seed.y) && neighbourCounts.Get(xLeft - 1, seed.y) == 0)
+		{
+			xLeft--;
+		}
+		int xRight = seed.x;
+		while (xRight < width - 1 && IsClosed(xRight + 1, seed.y) && neighbourCounts.Get(xRight + 1, seed.y) == 0)
 		{
-			for (pos.x = xStart; pos.x <= xEnd; pos.x++)
+			xRight++;
+		}
+		// the tiles either side of the run stopped it, so they cannot be closed
+		// zeros; they are revealed along with it
+		const int xRevealStart = xLeft > 0 && IsClosed(xLeft - 1, seed.y) ? xLeft - 1 : xLeft;
+		const int xRevealEnd = xRight < width - 1 && IsClosed(xRight + 1, seed.y) ? xRight + 1 : xRight;
+		RevealRun(seed.y, xRevealStart, xRevealEnd);
+
+		const int xStart = std::max(0, xLeft - 1);
+		const int xEnd = std::min(width - 1, xRight + 1);
+		for (int y = seed.y - 1; y <= seed.y + 1; y += 2)
+		{
+			if (y < 0 || y >= height) continue;
+			bool inZeroRun = false;
+			// adjacent numbers are revealed together as one run
+			int numberRunStart = -1;
+			for (int x = xStart; x <= xEnd; x++)
 			{
-				RevealAdjacentTiles(pos);
+				const bool isNumber = IsClosed(x, y) && neighbourCounts.Get(x, y) != 0;
+				if (isNumber && numberRunStart < 0)
+				{
+					numberRunStart = x;
+				}
+				else if (!isNumber && numberRunStart >= 0)
+				{
+					RevealRun(y, numberRunStart, x - 1);
+					numberRunStart = -1;
+				}
+
+				if (!IsClosed(x, y) || isNumber)
+				{
+					inZeroRun = false;
+				}
+				else if (!inZeroRun)
+				{
+					openingSeeds.push_back({ x, y });
+					inZeroRun = true;
+				}
+			}
+			if (numberRunStart >= 0)
+			{
+				RevealRun(y, numberRunStart, xEnd);
 			}
 		}
 	}
+}
 
+void MineField::RevealIndexedOpening(int opening)
+{
+	// an opening holds no mines, so every closed tile of a span is revealed
+	// and counted 64 at a time; flagged border numbers stay closed
+	for (const OpeningIndex::Span* span = openingIndex.GetSpansBegin(opening); span != openingIndex.GetSpansEnd(opening); ++span)
+	{
+		uint64_t* revealedRow = revealed.Row(span->y);
+		for (int i = span->xStart >> 6; i <= span->xEnd >> 6; i++)
+		{
+			const int xBase = i * 64;
+			uint64_t spanMask = ~uint64_t(0);
+			if (span->xStart > xBase)
+			{
+				spanMask &= ~uint64_t(0) << (span->xStart - xBase);
+			}
+			if (span->xEnd < xBase + 63)
+			{
+				spanMask &= ~uint64_t(0) >> (63 - (span->xEnd - xBase));
+			}
+			const uint64_t closed = GetClosedWord(span->y, i) & spanMask;
+			assert((closed & mines.Row(span->y)[i]) == 0);
+			revealedRow[i] |= closed;
+			nSafeTilesLeft -= BitGrid::Popcount(closed);
 
+			// the newly revealed tiles are recorded as runs, joined across words
+			for (uint64_t bits = closed; bits != 0;)
+			{
+				const int start = BitGrid::CountTrailingZeros(bits);
+				const uint64_t gaps = ~bits & (~uint64_t(0) << start);
+				const int end = gaps != 0 ? BitGrid::CountTrailingZeros(gaps) : 64;
+				bits = end < 64 ? bits & (~uint64_t(0) << end) : 0u;
+				if (!changedRuns.empty() && changedRuns.back().y == span->y && changedRuns.back().xEnd == xBase + start - 1)
+				{
+					changedRuns.back().xEnd = xBase + end - 1;
+				}
+				else
+				{
+					changedRuns.push_back({ span->y, xBase + start, xBase + end - 1 });
+				}
+			}
+		}
+	}
+}
 
+void MineField::UpdateIndex()
+{
+	// A click only changes the tiles in changedRuns, so frontier and constraint
+	// membership can only change within one tile of them. Each affected word is
+	// queued once and recomputed from the bit-planes, 64 tiles at a time:
+	//   frontier   = closed & next to a revealed tile
+	//   constraint = revealed & safe & next to a closed tile
+	const int wordsPerRow = revealed.GetWordsPerRow();
+	for (const TileRun& run : changedRuns)
+	{
+		for (int y = std::max(0, run.y - 1); y <= std::min(height - 1, run.y + 1); y++)
+		{
+			for (int i = std::max(0, run.xStart - 1) >> 6; i <= std::min(width - 1, run.xEnd + 1) >> 6; i++)
+			{
+				const size_t word = size_t(y) * wordsPerRow + i;
+				uint64_t& dirtyBits = dirtyWordBits[word >> 6];
+				const uint64_t bit = uint64_t(1) << (word & 63);
+				if ((dirtyBits & bit) == 0)
+				{
+					dirtyBits |= bit;
+					dirtyWords.push_back(word);
+				}
+			}
+		}
+	}
 
+	// bit set where any tile of the 3x3 around it is set, from the three
+	// words' vertical ORs
+	auto dilate = [](uint64_t left, uint64_t centre, uint64_t right)
+	{
+		return centre | (centre << 1) | (left >> 63) | (centre >> 1) | (right << 63);
+	};
+	for (const size_t word : dirtyWords)
+	{
+		dirtyWordBits[word >> 6] &= ~(uint64_t(1) << (word & 63));
+		const int y = int(word / wordsPerRow);
+		const int i = int(word % wordsPerRow);
+		uint64_t closedColumns[3];
+		uint64_t revealedColumns[3];
+		for (int column = 0; column < 3; column++)
+		{
+			closedColumns[column] = GetClosedWord(y - 1, i - 1 + column) | GetClosedWord(y, i - 1 + column) |
+				GetClosedWord(y + 1, i - 1 + column);
+			revealedColumns[column] = GetRevealedWord(y - 1, i - 1 + column) | GetRevealedWord(y, i - 1 + column) |
+				GetRevealedWord(y + 1, i - 1 + column);
+		}
+		const uint64_t closedAround = dilate(closedColumns[0], closedColumns[1], closedColumns[2]);
+		const uint64_t revealedAround = dilate(revealedColumns[0], revealedColumns[1], revealedColumns[2]);
+		frontier.SetWord(y, i, GetClosedWord(y, i) & revealedAround);
+		constraintTiles.SetWord(y, i, revealed.Row(y)[i] & ~mines.Row(y)[i] & closedAround);
+	}
+	dirtyWords.clear();
 }
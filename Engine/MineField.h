@@ -1,11 +1,14 @@
 #pragma once
 #include "Vei2.h"
-#include "Graphics.h"
-#include "RectI.h"
-#include "SpriteCodex.h"
-#include "Colors.h"
-#include "Sound.h"
+#include "BitGrid.h"
+#include "NibbleGrid.h"
+#include "OpeningIndex.h"
+#include "TileSet.h"
+#include <cstdint>
+#include <vector>
 
+// Board rules only: no Graphics/Sound dependencies so the field can be built
+// and simulated headless (see MineFieldView for the drawing adapter)
 class MineField
 {
 public:
@@ -15,9 +18,10 @@ public:
 		Win,
 		Lose
 	};
-private:
+	// read-only snapshot of one tile, assembled from the board's bit-planes
 	class Tile
 	{
+		friend MineField;
 	public:
 		enum class State
 		{
@@ -26,42 +30,153 @@ private:
 			Revealed
 		};
 	public:
-		void SpawnMine();
-		void Draw(const Vei2& screenPos, MineField::GameState gameState, Graphics& gfx) const;
-		void Reveal();
-		bool IsRevealed() const;
-		bool IsHidden() const;
-		bool IsFlagged() const;
-		bool HasMine() const;
-		int GetNeighbourMineCount();
-		void ToggleFlag();
-		void SetNeighbourMineCount(int mineCount);
+		bool IsRevealed() const
+		{
+			return state == State::Revealed;
+		}
+		bool IsHidden() const
+		{
+			return state == State::Hidden;
+		}
+		bool IsFlagged() const
+		{
+			return state == State::Flagged;
+		}
+		bool HasMine() const
+		{
+			return hasMine;
+		}
+		int GetNeighbourMineCount() const
+		{
+			return nNeighbourMines;
+		}
 	private:
-		State state = State::Hidden;
-		bool hasMine = false;
-		int nNeighbourMines = -1;
+		Tile(State state, bool hasMine, int nNeighbourMines)
+			:
+			state(state),
+			hasMine(hasMine),
+			nNeighbourMines(nNeighbourMines)
+		{
+		}
+	private:
+		State state;
+		bool hasMine;
+		int nNeighbourMines;
+	};
+	// tiles xStart..xEnd (inclusive) of row y
+	struct TileRun
+	{
+		int y;
+		int xStart;
+		int xEnd;
 	};
 
 public:
-	MineField(int nMines);
-	void Draw(Graphics& gfx) const;
-	RectI GetRect() const;
-	bool OnRevealClick(const Vei2& screenPos);
-	void OnFlagClick(const Vei2& screenPos);
+	// Mines are not placed until the first reveal (or an explicit Generate),
+	// so the first click is always safe. The same (width, height, nMines, seed,
+	// first click) always produces the same board, whatever number of threads
+	// generates it (0 = one per hardware thread).
+	MineField(int width, int height, int nMines, uint64_t seed, int nThreads = 0);
+	// places the mines keeping safePos and, when there is room, its 3x3
+	// neighbourhood clear; does nothing once the board is generated
+	void Generate(const Vei2& safePos);
+	bool IsGenerated() const;
+	// has Generate also build an OpeningIndex, so a click on a zero reveals
+	// its precomputed spans rather than searching: steadier latency on huge
+	// boards for a little memory. Must be called before generation.
+	void EnableOpeningIndex();
+	// returns true if the reveal hit a mine
+	bool OnRevealClick(const Vei2& gridPos);
+	void OnFlagClick(const Vei2& gridPos);
+	// tiles whose visible state changed in the last reveal/flag click, so
+	// observers (e.g. MineSolver) can update incrementally instead of
+	// rescanning; kept as row runs since openings reveal whole runs at a time
+	const std::vector<TileRun>& GetLastChangedRuns() const;
+	// closed (hidden, unflagged) tiles next to a revealed tile, and the
+	// revealed safe tiles that still have closed neighbours, i.e. the numbers
+	// a solver has to satisfy. Both are kept up to date by every click.
+	const TileSet& GetFrontier() const;
+	const TileSet& GetConstraintTiles() const;
+	// inline: solvers and views call this for every tile they look at
+	Tile TileAt(const Vei2& gridPos) const
+	{
+		const bool hasMine = mines.Get(gridPos.x, gridPos.y);
+		Tile::State state = Tile::State::Hidden;
+		if (revealed.Get(gridPos.x, gridPos.y))
+		{
+			state = Tile::State::Revealed;
+		}
+		else if (flagged.Get(gridPos.x, gridPos.y))
+		{
+			state = Tile::State::Flagged;
+		}
+		return Tile(state, hasMine, hasMine ? -1 : neighbourCounts.Get(gridPos.x, gridPos.y));
+	}
+	// the raw planes behind TileAt, for whole-board passes such as
+	// BoardAnalysis; neighbour counts are only meaningful on safe tiles
+	const BitGrid& GetMines() const;
+	const NibbleGrid& GetNeighbourCounts() const;
+	GameState GetGameState() const;
+	int GetWidth() const;
+	int GetHeight() const;
+	int GetMineCount() const;
+	uint64_t GetSeed() const;
+	long long CountRevealed() const;
+	long long CountFlagged() const;
+	// the kept counts behind the two above, without their debug recounts of
+	// the whole board; for callers that must stay cheap on any board size
+	long long GetSafeTilesLeft() const;
+	long long GetFlagCount() const;
+	size_t GetMemoryBytes() const;
 private:
-	Tile & TileAt(const Vei2& gridPos);
-	const Tile& TileAt(const Vei2& gridPos) const;
-	Vei2 GetGridPos(const Vei2& screenPos ) const;
-	int CountNeighboursMines(const Vei2& gridPos);
-	void DrawBorder(Graphics& gfx) const;
-	void CheckForWin();
-	void RevealAdjacentTiles(const Vei2& gridPos);
+	int CountNeighboursMines(const Vei2& gridPos) const;
+	// full-board recount of nSafeTilesLeft, only for debug consistency asserts
+	long long CountSafeTilesLeft() const;
+	void RevealTile(int x, int y);
+	// reveals xStart..xEnd of row y and records them as one changed run
+	void RevealRun(int y, int xStart, int xEnd);
+	bool IsClosed(int x, int y) const;
+	// closed / revealed bits of one word of row y, 0 outside the board
+	uint64_t GetClosedWord(int y, int wordIndex) const;
+	uint64_t GetRevealedWord(int y, int wordIndex) const;
+	void RevealOpening(const Vei2& gridPos);
+	// reveals every closed tile of an indexed opening, word by word
+	void RevealIndexedOpening(int opening);
+	// brings the frontier / constraint sets up to date with changedRuns, once
+	// the whole opening is known
+	void UpdateIndex();
 private:
-	static constexpr int width = 20;
-	static constexpr int height = 16;
-	static constexpr int xPadding = Graphics::ScreenWidth / 2 - width / 2 * SpriteCodex::tileSize;
-	static constexpr int yPadding = Graphics::ScreenHeight / 2 - height / 2 * SpriteCodex::tileSize;
-	static constexpr Color borderColor = Colors::Blue;
+	int width;
+	int height;
+	int nMines;
+	uint64_t seed;
+	int nThreads;
+	bool isGenerated = false;
 	GameState gameState = GameState::Playing;
-	Tile field[width * height];
-};
\ No newline at end of file
+	// safe tiles not yet revealed; the game is won when all of them are
+	// flagged (nSafeTilesFlagged, counted once the mines are placed)
+	long long nSafeTilesLeft;
+	long long nSafeTilesFlagged = 0;
+	long long nFlagged = 0;
+	// structure-of-arrays tile storage: 3 bit-planes + 4-bit neighbour counts
+	BitGrid mines;
+	BitGrid revealed;
+	BitGrid flagged;
+	NibbleGrid neighbourCounts;
+	// span seeds for RevealOpening, kept between calls to avoid reallocating
+	std::vector<Vei2> openingSeeds;
+	std::vector<TileRun> changedRuns;
+	bool isOpeningIndexEnabled = false;
+	OpeningIndex openingIndex;
+	// per indexed opening: flagged zero tiles in it, and whether a flood fill
+	// has already opened part of it. The spans are only used while neither
+	// applies, since either can make the real opening smaller.
+	std::vector<int> openingFlagCounts;
+	std::vector<char> isOpeningSplit;
+	TileSet frontier;
+	TileSet constraintTiles;
+	// words (row * wordsPerRow + word) UpdateIndex has to recompute, with one
+	// bit per word so each is queued once
+	std::vector<size_t> dirtyWords;
+	std::vector<uint64_t> dirtyWordBits;
+};
@@ -0,0 +1,229 @@
+#include "MineFieldView.h"
+#include <algorithm>
+
+constexpr Color MineFieldView::borderColor;
+constexpr Color MineFieldView::highlightColor;
+
+MineFieldView::MineFieldView(MineField& field, const Vei2& center)
+	:
+	field(field),
+	topLeft(center - Vei2(field.GetWidth() / 2, field.GetHeight() / 2) * SpriteCodex::tileSize),
+	drawnState(field.GetGameState())
+{
+}
+
+void MineFieldView::Draw(Graphics& gfx)
+{
+	// the game state decides how every tile looks
+	if (field.GetGameState() != drawnState)
+	{
+		Invalidate();
+	}
+	if (isFullRedrawPending)
+	{
+		DrawAll(gfx);
+		isFullRedrawPending = false;
+		dirtyRuns.clear();
+		drawnState = field.GetGameState();
+		return;
+	}
+	// once the game is over nothing but the highlight can change, and that is
+	// not drawn any more; redrawing its tile would cut into the win screen
+	if (field.GetGameState() != MineField::GameState::Playing)
+	{
+		dirtyRuns.clear();
+	}
+	if (dirtyRuns.empty()) return;
+
+	const RectI visibleTiles = GetVisibleTiles(gfx.GetRect());
+	for (const MineField::TileRun& run : dirtyRuns)
+	{
+		if (run.y < visibleTiles.top || run.y >= visibleTiles.bottom) continue;
+		const int xEnd = std::min(run.xEnd + 1, visibleTiles.right);
+		for (Vei2 gridPos = { std::max(run.xStart, visibleTiles.left),run.y }; gridPos.x < xEnd; gridPos.x++)
+		{
+			DrawTile(gridPos, gfx);
+		}
+	}
+	dirtyRuns.clear();
+	if (hasHighlight && field.GetGameState() == MineField::GameState::Playing)
+	{
+		DrawHighlight(gfx);
+	}
+}
+
+void MineFieldView::Invalidate()
+{
+	isFullRedrawPending = true;
+}
+
+bool MineFieldView::IsFullRedrawPending() const
+{
+	return isFullRedrawPending || field.GetGameState() != drawnState;
+}
+
+void MineFieldView::DrawAll(Graphics& gfx) const
+{
+	// boards larger than the screen are clipped to the visible tile range;
+	// every tile sprite has the base colour baked in, so no background fill
+	DrawBorder(gfx);
+	const RectI visibleTiles = GetVisibleTiles(gfx.GetRect());
+	for (Vei2 gridPos = { visibleTiles.left,visibleTiles.top }; gridPos.y < visibleTiles.bottom; gridPos.y++)
+	{
+		for (gridPos.x = visibleTiles.left; gridPos.x < visibleTiles.right; gridPos.x++)
+		{
+			DrawTile(gridPos, gfx);
+		}
+	}
+	if (hasHighlight && field.GetGameState() == MineField::GameState::Playing)
+	{
+		DrawHighlight(gfx);
+	}
+
+	if (field.GetGameState() == MineField::GameState::Win)
+	{
+		SpriteCodex::DrawWin({Graphics::ScreenWidth / 2,
+			Graphics::ScreenHeight / 2 }, 
+			gfx);
+	}
+}
+
+RectI MineFieldView::GetRect() const
+{
+	return RectI(topLeft, SpriteCodex::tileSize * field.GetWidth(), SpriteCodex::tileSize * field.GetHeight());
+}
+
+bool MineFieldView::OnRevealClick(const Vei2& screenPos)
+{
+	// once the game is over clicks change nothing, and GetLastChangedRuns
+	// still holds the runs of the last click that did
+	if (field.GetGameState() != MineField::GameState::Playing) return false;
+	const bool hitMine = field.OnRevealClick(GetGridPos(screenPos));
+	MarkDirty(field.GetLastChangedRuns());
+	return hitMine;
+}
+
+void MineFieldView::OnFlagClick(const Vei2 & screenPos)
+{
+	if (field.GetGameState() != MineField::GameState::Playing) return;
+	field.OnFlagClick(GetGridPos(screenPos));
+	MarkDirty(field.GetLastChangedRuns());
+}
+
+void MineFieldView::SetHighlight(const Vei2& gridPos)
+{
+	ClearHighlight();
+	highlightPos = gridPos;
+	hasHighlight = true;
+	dirtyRuns.push_back({ gridPos.y, gridPos.x, gridPos.x });
+}
+
+void MineFieldView::ClearHighlight()
+{
+	// redrawing the tile erases the outline
+	if (hasHighlight)
+	{
+		dirtyRuns.push_back({ highlightPos.y, highlightPos.x, highlightPos.x });
+	}
+	hasHighlight = false;
+}
+
+void MineFieldView::MarkDirty(const std::vector<MineField::TileRun>& changedRuns)
+{
+	dirtyRuns.insert(dirtyRuns.end(), changedRuns.begin(), changedRuns.end());
+}
+
+void MineFieldView::DrawTile(const Vei2& gridPos, Graphics& gfx) const
+{
+	const MineField::Tile tile = field.TileAt(gridPos);
+	const Vei2 screenPos = gridPos * SpriteCodex::tileSize + topLeft;
+	if (field.GetGameState() == MineField::GameState::Playing)
+	{
+		if (tile.IsHidden())
+		{
+			SpriteCodex::DrawTileButton(screenPos, gfx);
+		}
+		else if (tile.IsFlagged())
+		{
+			SpriteCodex::DrawTileButton(screenPos, gfx);
+			SpriteCodex::DrawTileFlag(screenPos, gfx);
+		}
+		else if (tile.HasMine())
+		{
+			SpriteCodex::DrawTileBomb(screenPos, gfx);
+		}
+		else
+		{
+			SpriteCodex::DrawTileNumber(screenPos, tile.GetNeighbourMineCount(), gfx);
+		}
+	}
+	else
+	{
+		if (tile.IsFlagged())
+		{
+			if (tile.HasMine())
+			{
+				SpriteCodex::DrawTileBomb(screenPos, gfx);
+				SpriteCodex::DrawTileFlag(screenPos, gfx);
+			}
+			else
+			{
+				SpriteCodex::DrawTileNumber(screenPos, tile.GetNeighbourMineCount(), gfx);
+				SpriteCodex::DrawTileCross(screenPos, gfx);
+			}
+		}
+		else if (tile.HasMine())
+		{
+			if (tile.IsRevealed())
+			{
+				SpriteCodex::DrawTileBombRed(screenPos, gfx);
+			}
+			else
+			{
+				SpriteCodex::DrawTileBomb(screenPos, gfx);
+			}
+		}
+		else
+		{
+			SpriteCodex::DrawTileNumber(screenPos, tile.GetNeighbourMineCount(), gfx);
+		}
+	}
+}
+
+void MineFieldView::DrawBorder(Graphics & gfx) const
+{
+	gfx.DrawRect(GetRect().GetExpanded(SpriteCodex::tileSize).GetClippedTo(gfx.GetRect()), borderColor);
+}
+
+void MineFieldView::DrawHighlight(Graphics& gfx) const
+{
+	const RectI screenRect = gfx.GetRect();
+	const RectI tileRect(highlightPos * SpriteCodex::tileSize + topLeft, SpriteCodex::tileSize, SpriteCodex::tileSize);
+	const RectI edges[] = {
+		RectI(tileRect.left, tileRect.right, tileRect.top, tileRect.top + highlightThickness),
+		RectI(tileRect.left, tileRect.right, tileRect.bottom - highlightThickness, tileRect.bottom),
+		RectI(tileRect.left, tileRect.left + highlightThickness, tileRect.top, tileRect.bottom),
+		RectI(tileRect.right - highlightThickness, tileRect.right, tileRect.top, tileRect.bottom)
+	};
+	for (const RectI& edge : edges)
+	{
+		if (edge.IsOverlappingWith(screenRect))
+		{
+			gfx.DrawRect(edge.GetClippedTo(screenRect), highlightColor);
+		}
+	}
+}
+
+RectI MineFieldView::GetVisibleTiles(const RectI& screenRect) const
+{
+	return RectI(
+		std::max(0, (screenRect.left - topLeft.x) / SpriteCodex::tileSize),
+		std::min(field.GetWidth(), (screenRect.right - topLeft.x + SpriteCodex::tileSize - 1) / SpriteCodex::tileSize),
+		std::max(0, (screenRect.top - topLeft.y) / SpriteCodex::tileSize),
+		std::min(field.GetHeight(), (screenRect.bottom - topLeft.y + SpriteCodex::tileSize - 1) / SpriteCodex::tileSize));
+}
+
+Vei2 MineFieldView::GetGridPos(const Vei2 & screenPos) const
+{
+	return (screenPos - topLeft) / SpriteCodex::tileSize;
+}
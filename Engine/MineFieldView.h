@@ -0,0 +1,51 @@
+#pragma once
+#include "MineField.h"
+#include "Graphics.h"
+#include "RectI.h"
+#include "SpriteCodex.h"
+#include "Colors.h"
+#include <vector>
+
+// Drawing and screen-space input adapter for a MineField
+class MineFieldView
+{
+public:
+	MineFieldView(MineField& field, const Vei2& center);
+	// Redraws only what changed since the last Draw: the tiles changed by the
+	// view's clicks, the highlight, and everything when the game state changes.
+	// The frame buffer must keep its contents between frames.
+	void Draw(Graphics& gfx);
+	// redraw everything next time, e.g. after the frame buffer was cleared or
+	// the field was changed other than through this view
+	void Invalidate();
+	// true if the next Draw redraws everything (after Invalidate or a change
+	// of game state), which is when the frame can be cleared first
+	bool IsFullRedrawPending() const;
+	RectI GetRect() const;
+	// returns true if the reveal hit a mine
+	bool OnRevealClick(const Vei2& screenPos);
+	void OnFlagClick(const Vei2& screenPos);
+	// outlines one tile (e.g. a MoveAdvisor hint) until cleared
+	void SetHighlight(const Vei2& gridPos);
+	void ClearHighlight();
+private:
+	void MarkDirty(const std::vector<MineField::TileRun>& changedRuns);
+	void DrawAll(Graphics& gfx) const;
+	void DrawTile(const Vei2& gridPos, Graphics& gfx) const;
+	void DrawBorder(Graphics& gfx) const;
+	void DrawHighlight(Graphics& gfx) const;
+	// grid rectangle (right / bottom exclusive) of the tiles on screen
+	RectI GetVisibleTiles(const RectI& screenRect) const;
+	Vei2 GetGridPos(const Vei2& screenPos) const;
+private:
+	static constexpr Color borderColor = Colors::Blue;
+	static constexpr Color highlightColor = Colors::Green;
+	static constexpr int highlightThickness = 2;
+	MineField& field;
+	Vei2 topLeft;
+	Vei2 highlightPos = { 0, 0 };
+	bool hasHighlight = false;
+	std::vector<MineField::TileRun> dirtyRuns;
+	bool isFullRedrawPending = true;
+	MineField::GameState drawnState;
+};
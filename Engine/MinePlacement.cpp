@@ -0,0 +1,151 @@
+#include "MinePlacement.h"
+#include "Parallel.h"
+#include <assert.h>
+#include <algorithm>
+#include <vector>
+
+void MinePlacement::Place(BitGrid& mines, int nMines, uint64_t seed, int nThreads,
+	const std::vector<Vei2>& safeTiles)
+{
+	const int width = mines.GetWidth();
+	const int height = mines.GetHeight();
+
+	// sorted tile indices; bands read their slice of this through lower_bound
+	std::vector<long long> excluded;
+	excluded.reserve(safeTiles.size());
+	for (const Vei2& tile : safeTiles)
+	{
+		assert(tile.x >= 0 && tile.x < width && tile.y >= 0 && tile.y < height);
+		excluded.push_back(static_cast<long long>(tile.y) * width + tile.x);
+	}
+	std::sort(excluded.begin(), excluded.end());
+	excluded.erase(std::unique(excluded.begin(), excluded.end()), excluded.end());
+
+	const long long nAllowedTiles = static_cast<long long>(width) * height - static_cast<long long>(excluded.size());
+	assert(nMines >= 0 && nMines <= nAllowedTiles);
+
+	const int bandRows = GetBandRows(width);
+	const int nBands = (height + bandRows - 1) / bandRows;
+	std::vector<long long> bandMines(nBands);
+	std::vector<size_t> bandExcluded(nBands + 1);
+	CounterRng splitRng(seed, splitStream);
+	long long tilesLeft = nAllowedTiles;
+	long long minesLeft = nMines;
+	for (int band = 0; band < nBands; band++)
+	{
+		const long long bandStart = static_cast<long long>(width) * band * bandRows;
+		const long long bandEnd = static_cast<long long>(width) * std::min(height, (band + 1) * bandRows);
+		bandExcluded[band] = std::lower_bound(excluded.begin(), excluded.end(), bandStart) - excluded.begin();
+		bandExcluded[band + 1] = std::lower_bound(excluded.begin(), excluded.end(), bandEnd) - excluded.begin();
+		const long long nBandTiles = bandEnd - bandStart - static_cast<long long>(bandExcluded[band + 1] - bandExcluded[band]);
+		bandMines[band] = SampleHypergeometric(splitRng, tilesLeft, minesLeft, nBandTiles);
+		tilesLeft -= nBandTiles;
+		minesLeft -= bandMines[band];
+	}
+	assert(minesLeft == 0);
+
+	ParallelFor(nBands, nThreads, [&](int band)
+	{
+		CounterRng rng(seed, uint64_t(band));
+		const long long* excludedBase = excluded.data();
+		PlaceInBand(mines, band * bandRows, std::min(height, (band + 1) * bandRows), bandMines[band], rng,
+			excludedBase + bandExcluded[band], excludedBase + bandExcluded[band + 1]);
+	});
+}
+
+int MinePlacement::GetBandRows(int width)
+{
+	return std::max(1, bandTiles / width);
+}
+
+long long MinePlacement::SampleHypergeometric(CounterRng& rng, long long nTotal, long long nMarked, long long nDrawn)
+{
+	assert(nMarked >= 0 && nMarked <= nTotal);
+	assert(nDrawn >= 0 && nDrawn <= nTotal);
+	const long long lo = std::max(0ll, nDrawn + nMarked - nTotal);
+	const long long hi = std::min(nDrawn, nMarked);
+	if (lo == hi)
+	{
+		return lo;
+	}
+
+	// Inversion over weights relative to the mode, built with the pmf ratio
+	// P(k+1)/P(k) = (K-k)(n-k) / ((k+1)(N-K-n+k+1)). The walk stops once the
+	// weights are negligible, so the cost is O(standard deviation).
+	const long long mode = std::min(hi, std::max(lo, (nDrawn + 1) * (nMarked + 1) / (nTotal + 2)));
+	constexpr double negligible = 1e-20;
+	std::vector<double> weightsBelow;
+	std::vector<double> weightsAbove;
+	double total = 1.0;
+	double weight = 1.0;
+	for (long long k = mode; k > lo && weight > negligible; k--)
+	{
+		weight *= double(k) * double(nTotal - nMarked - nDrawn + k) /
+			(double(nMarked - k + 1) * double(nDrawn - k + 1));
+		weightsBelow.push_back(weight);
+		total += weight;
+	}
+	weight = 1.0;
+	for (long long k = mode; k < hi && weight > negligible; k++)
+	{
+		weight *= double(nMarked - k) * double(nDrawn - k) /
+			(double(k + 1) * double(nTotal - nMarked - nDrawn + k + 1));
+		weightsAbove.push_back(weight);
+		total += weight;
+	}
+
+	double u = rng.NextDouble() * total;
+	for (size_t i = weightsBelow.size(); i-- > 0;)
+	{
+		u -= weightsBelow[i];
+		if (u < 0.0)
+		{
+			return mode - 1 - static_cast<long long>(i);
+		}
+	}
+	u -= 1.0;
+	if (u < 0.0)
+	{
+		return mode;
+	}
+	for (size_t i = 0; i < weightsAbove.size(); i++)
+	{
+		u -= weightsAbove[i];
+		if (u < 0.0)
+		{
+			return mode + 1 + static_cast<long long>(i);
+		}
+	}
+	// only reachable through rounding in the running total
+	return weightsAbove.empty() ? mode : mode + static_cast<long long>(weightsAbove.size());
+}
+
+void MinePlacement::PlaceInBand(BitGrid& mines, int yBegin, int yEnd, long long nBandMines, CounterRng& rng,
+	const long long* excludedBegin, const long long* excludedEnd)
+{
+	// Floyd: for j in [N-k, N) pick t in [0, j]; take t, or j if t is taken.
+	// Every k-subset comes out equally likely after exactly k draws.
+	// Ranks count allowed tiles only and are mapped to band tiles by stepping
+	// over the (few, sorted) excluded ones.
+	const int width = mines.GetWidth();
+	const long long bandStart = static_cast<long long>(width) * yBegin;
+	const uint64_t nAllowed = uint64_t(width) * (yEnd - yBegin) - uint64_t(excludedEnd - excludedBegin);
+	auto rankToTile = [&](uint64_t rank)
+	{
+		long long tile = bandStart + static_cast<long long>(rank);
+		for (const long long* e = excludedBegin; e != excludedEnd && *e <= tile; e++)
+		{
+			tile++;
+		}
+		return Vei2(int(tile % width), int(tile / width));
+	};
+	for (uint64_t j = nAllowed - nBandMines; j < nAllowed; j++)
+	{
+		Vei2 tile = rankToTile(rng.UniformBelow(j + 1));
+		if (mines.Get(tile.x, tile.y))
+		{
+			tile = rankToTile(j);
+		}
+		mines.Set(tile.x, tile.y);
+	}
+}
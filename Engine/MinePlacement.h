@@ -0,0 +1,34 @@
+#pragma once
+#include "BitGrid.h"
+#include "CounterRng.h"
+#include "Vei2.h"
+#include <vector>
+
+// Seeded mine placement, O(nMines) at any density.
+// The board is cut into bands of whole rows whose layout depends only on the
+// board width. The mine total is first split across the bands (a chain of
+// hypergeometric draws, so every board stays equally likely), then each band
+// places its share with Floyd's sampling from its own CounterRng stream
+// keyed by (seed, band index). Bands own disjoint rows of the BitGrid and can
+// be filled on any number of threads; the board is the same for every
+// thread count and on every platform.
+// Tiles listed in safeTiles never receive a mine; they are skipped when
+// mapping sample ranks to tiles, so exclusions cost no extra draws.
+class MinePlacement
+{
+public:
+	static void Place(BitGrid& mines, int nMines, uint64_t seed, int nThreads = 1,
+		const std::vector<Vei2>& safeTiles = std::vector<Vei2>());
+	static int GetBandRows(int width);
+	// number of marked items in nDrawn draws without replacement from nTotal
+	// items of which nMarked are marked
+	static long long SampleHypergeometric(CounterRng& rng, long long nTotal, long long nMarked, long long nDrawn);
+private:
+	static void PlaceInBand(BitGrid& mines, int yBegin, int yEnd, long long nBandMines, CounterRng& rng,
+		const long long* excludedBegin, const long long* excludedEnd);
+private:
+	// about a million tiles per band
+	static constexpr int bandTiles = 1 << 20;
+	// stream index used for splitting the mine total between bands
+	static constexpr uint64_t splitStream = ~uint64_t(0);
+};
@@ -0,0 +1,407 @@
+#include "MineProbability.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+namespace
+{
+	// a * b truncated to maxLength terms and rescaled so the largest is 1;
+	// callers only ever use ratios, so the scale is free to drop
+	std::vector<double> Convolve(const std::vector<double>& a, const std::vector<double>& b, size_t maxLength)
+	{
+		std::vector<double> result(std::min(a.size() + b.size() - 1, maxLength), 0.0);
+		for (size_t i = 0; i < a.size() && i < result.size(); i++)
+		{
+			for (size_t j = 0; j < b.size() && i + j < result.size(); j++)
+			{
+				result[i + j] += a[i] * b[j];
+			}
+		}
+		const double maxValue = *std::max_element(result.begin(), result.end());
+		if (maxValue > 0.0)
+		{
+			for (double& value : result)
+			{
+				value /= maxValue;
+			}
+		}
+		return result;
+	}
+
+	double Binomial(int n, int k)
+	{
+		double result = 1.0;
+		for (int i = 1; i <= k; i++)
+		{
+			result = result * (n - k + i) / i;
+		}
+		return result;
+	}
+}
+
+constexpr int MineProbability::clockCheckInterval;
+
+MineProbability::MineProbability(const MineField& field, std::chrono::steady_clock::time_point deadline)
+	:
+	field(field),
+	width(field.GetWidth()),
+	deadline(deadline)
+{
+	Collect();
+	if (!isConsistent || !isComplete) return;
+
+	const std::vector<std::vector<int>> components = SplitComponents();
+	if (!isComplete) return;
+	std::vector<Tally> tallies;
+	for (const std::vector<int>& cells : components)
+	{
+		tallies.push_back(Enumerate(cells));
+		if (!isConsistent || !isComplete) return;
+	}
+	Combine(components, tallies);
+}
+
+double MineProbability::GetProbability(const Vei2& gridPos) const
+{
+	const MineField::Tile tile = field.TileAt(gridPos);
+	if (tile.IsRevealed()) return 0.0;
+	if (tile.IsFlagged()) return 1.0;
+	const auto it = frontierIndex.find(static_cast<long long>(gridPos.y) * width + gridPos.x);
+	return it == frontierIndex.end() ? interiorProbability : probabilities[it->second];
+}
+
+double MineProbability::GetInteriorProbability() const
+{
+	return interiorProbability;
+}
+
+const std::vector<Vei2>& MineProbability::GetFrontier() const
+{
+	return frontier;
+}
+
+const std::vector<double>& MineProbability::GetFrontierProbabilities() const
+{
+	return probabilities;
+}
+
+bool MineProbability::IsConsistent() const
+{
+	return isConsistent;
+}
+
+bool MineProbability::IsComplete() const
+{
+	return isComplete;
+}
+
+void MineProbability::Collect()
+{
+	// the board's constraint index lists every revealed number with closed
+	// neighbours, so only the frontier is visited
+	const int height = field.GetHeight();
+	field.GetConstraintTiles().ForEachWhile([&](const Vei2& pos)
+	{
+		Constraint constraint;
+		constraint.nMines = field.TileAt(pos).GetNeighbourMineCount();
+		for (Vei2 other = { std::max(0, pos.x - 1), std::max(0, pos.y - 1) }; other.y <= std::min(height - 1, pos.y + 1); other.y++)
+		{
+			for (other.x = std::max(0, pos.x - 1); other.x <= std::min(width - 1, pos.x + 1); other.x++)
+			{
+				const MineField::Tile otherTile = field.TileAt(other);
+				if (otherTile.IsFlagged())
+				{
+					constraint.nMines--;
+				}
+				else if (otherTile.IsHidden())
+				{
+					const auto inserted = frontierIndex.emplace(static_cast<long long>(other.y) * width + other.x, int(frontier.size()));
+					if (inserted.second)
+					{
+						frontier.push_back(other);
+					}
+					constraint.cells.push_back(inserted.first->second);
+				}
+			}
+		}
+		if (constraint.nMines < 0 || constraint.nMines > int(constraint.cells.size()))
+		{
+			isConsistent = false;
+		}
+		constraint.nUnassigned = int(constraint.cells.size());
+		constraints.push_back(std::move(constraint));
+		return !IsOutOfTime(collectStepCost);
+	});
+	if (!isComplete) return;
+
+	const long long nFlags = field.CountFlagged();
+	const long long nHidden = static_cast<long long>(width) * height - field.CountRevealed() - nFlags;
+	assert(static_cast<long long>(frontier.size()) == static_cast<long long>(field.GetFrontier().GetSize()));
+	nMinesLeft = int(field.GetMineCount() - nFlags);
+	nInterior = nHidden - static_cast<long long>(frontier.size());
+	if (nMinesLeft < 0)
+	{
+		isConsistent = false;
+	}
+	probabilities.assign(frontier.size(), 0.0);
+	BuildGroups();
+}
+
+void MineProbability::BuildGroups()
+{
+	// constraint indices come out ascending, so equal sets compare equal
+	std::vector<std::vector<int>> cellConstraints(frontier.size());
+	for (int i = 0; i < int(constraints.size()); i++)
+	{
+		if (IsOutOfTime()) return;
+		for (int cell : constraints[i].cells)
+		{
+			cellConstraints[cell].push_back(i);
+		}
+	}
+	std::map<std::vector<int>, int> groupIds;
+	cellGroups.assign(frontier.size(), 0);
+	for (int cell = 0; cell < int(frontier.size()); cell++)
+	{
+		if (IsOutOfTime(collectStepCost)) return;
+		const auto inserted = groupIds.emplace(cellConstraints[cell], int(groups.size()));
+		if (inserted.second)
+		{
+			Group group;
+			group.constraints = cellConstraints[cell];
+			groups.push_back(std::move(group));
+		}
+		groups[inserted.first->second].nCells++;
+		cellGroups[cell] = inserted.first->second;
+	}
+	for (Constraint& constraint : constraints)
+	{
+		for (int cell : constraint.cells)
+		{
+			if (std::find(constraint.groups.begin(), constraint.groups.end(), cellGroups[cell]) == constraint.groups.end())
+			{
+				constraint.groups.push_back(cellGroups[cell]);
+			}
+		}
+	}
+	assignment.assign(groups.size(), 0);
+}
+
+std::vector<std::vector<int>> MineProbability::SplitComponents()
+{
+	// breadth-first from each unvisited group through the numbers it touches;
+	// the visiting order also closes constraints early during enumeration
+	std::vector<std::vector<int>> components;
+	std::vector<bool> isVisited(groups.size(), false);
+	for (int start = 0; start < int(groups.size()); start++)
+	{
+		if (isVisited[start]) continue;
+		if (IsOutOfTime()) break;
+		std::vector<int> groupIds(1, start);
+		isVisited[start] = true;
+		for (size_t i = 0; i < groupIds.size(); i++)
+		{
+			for (int constraint : groups[groupIds[i]].constraints)
+			{
+				for (int group : constraints[constraint].groups)
+				{
+					if (!isVisited[group])
+					{
+						isVisited[group] = true;
+						groupIds.push_back(group);
+					}
+				}
+			}
+		}
+		components.push_back(std::move(groupIds));
+	}
+	return components;
+}
+
+MineProbability::Tally MineProbability::Enumerate(const std::vector<int>& groupIds)
+{
+	Tally tally;
+	for (int group : groupIds)
+	{
+		tally.nCells += groups[group].nCells;
+	}
+	const size_t nCounts = size_t(tally.nCells) + 1;
+	tally.nSolutions.assign(nCounts, 0.0);
+	tally.nMineSolutions.assign(groupIds.size() * nCounts, 0.0);
+	Enumerate(groupIds, 0, 0, 1.0, tally);
+	if (!isComplete) return tally;
+
+	const double maxSolutions = *std::max_element(tally.nSolutions.begin(), tally.nSolutions.end());
+	if (maxSolutions == 0.0)
+	{
+		isConsistent = false;
+		return tally;
+	}
+	for (double& value : tally.nSolutions)
+	{
+		value /= maxSolutions;
+	}
+	for (double& value : tally.nMineSolutions)
+	{
+		value /= maxSolutions;
+	}
+	return tally;
+}
+
+void MineProbability::Enumerate(const std::vector<int>& groupIds, int i, int nMinesPlaced, double nWays, Tally& tally)
+{
+	if (nMinesPlaced > nMinesLeft || IsOutOfTime()) return;
+	if (i == int(groupIds.size()))
+	{
+		const size_t nCounts = size_t(tally.nCells) + 1;
+		tally.nSolutions[nMinesPlaced] += nWays;
+		for (size_t j = 0; j < groupIds.size(); j++)
+		{
+			const Group& group = groups[groupIds[j]];
+			tally.nMineSolutions[j * nCounts + nMinesPlaced] += nWays * assignment[groupIds[j]] / group.nCells;
+		}
+		return;
+	}
+
+	const int groupId = groupIds[i];
+	const Group& group = groups[groupId];
+	for (int nGroupMines = 0; nGroupMines <= group.nCells; nGroupMines++)
+	{
+		if (!CanAssign(groupId, nGroupMines)) continue;
+		for (int constraint : group.constraints)
+		{
+			constraints[constraint].nMinesAssigned += nGroupMines;
+			constraints[constraint].nUnassigned -= group.nCells;
+		}
+		assignment[groupId] = nGroupMines;
+		Enumerate(groupIds, i + 1, nMinesPlaced + nGroupMines, nWays * Binomial(group.nCells, nGroupMines), tally);
+		for (int constraint : group.constraints)
+		{
+			constraints[constraint].nMinesAssigned -= nGroupMines;
+			constraints[constraint].nUnassigned += group.nCells;
+		}
+	}
+	assignment[groupId] = 0;
+}
+
+bool MineProbability::CanAssign(int group, int nGroupMines) const
+{
+	// every number must still be able to reach its count exactly
+	for (int i : groups[group].constraints)
+	{
+		const Constraint& constraint = constraints[i];
+		const int nMinesAssigned = constraint.nMinesAssigned + nGroupMines;
+		if (nMinesAssigned > constraint.nMines ||
+			nMinesAssigned + constraint.nUnassigned - groups[group].nCells < constraint.nMines)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void MineProbability::Combine(const std::vector<std::vector<int>>& components, const std::vector<Tally>& tallies)
+{
+	// ways[K]: arrangements of the other nMinesLeft - K mines in the interior,
+	// C(nInterior, nMinesLeft - K). These overflow any fixed-width integer on
+	// big boards, so they are kept as doubles relative to the largest term.
+	const size_t maxLength = size_t(nMinesLeft) + 1;
+	std::vector<double> ways(maxLength, 0.0);
+	double maxLogWays = -std::numeric_limits<double>::infinity();
+	std::vector<double> logWays(maxLength, maxLogWays);
+	for (int nFrontierMines = 0; nFrontierMines <= nMinesLeft; nFrontierMines++)
+	{
+		if (IsOutOfTime()) return;
+		const long long nInteriorMines = nMinesLeft - nFrontierMines;
+		if (nInteriorMines > nInterior) continue;
+		logWays[nFrontierMines] = std::lgamma(double(nInterior) + 1.0) - std::lgamma(double(nInteriorMines) + 1.0) -
+			std::lgamma(double(nInterior - nInteriorMines) + 1.0);
+		maxLogWays = std::max(maxLogWays, logWays[nFrontierMines]);
+	}
+	for (size_t i = 0; i < maxLength; i++)
+	{
+		ways[i] = std::exp(logWays[i] - maxLogWays);
+	}
+
+	// mine-count distributions of all components before / after each one
+	const size_t nComponents = components.size();
+	std::vector<double> groupProbabilities(groups.size(), 0.0);
+	std::vector<std::vector<double>> prefix(nComponents + 1, std::vector<double>(1, 1.0));
+	std::vector<std::vector<double>> suffix(nComponents + 1, std::vector<double>(1, 1.0));
+	// each convolution can be long, so the clock is read before every one
+	for (size_t c = 0; c < nComponents; c++)
+	{
+		if (IsOutOfTime(clockCheckInterval)) return;
+		prefix[c + 1] = Convolve(prefix[c], tallies[c].nSolutions, maxLength);
+	}
+	for (size_t c = nComponents; c-- > 0;)
+	{
+		if (IsOutOfTime(clockCheckInterval)) return;
+		suffix[c] = Convolve(tallies[c].nSolutions, suffix[c + 1], maxLength);
+	}
+
+	for (size_t c = 0; c < nComponents; c++)
+	{
+		if (IsOutOfTime(clockCheckInterval)) return;
+		// weight[k]: ways to complete the board when component c holds k mines
+		const std::vector<double> others = Convolve(prefix[c], suffix[c + 1], maxLength);
+		const std::vector<int>& groupIds = components[c];
+		const size_t nCounts = size_t(tallies[c].nCells) + 1;
+		std::vector<double> weight(nCounts, 0.0);
+		double total = 0.0;
+		for (size_t k = 0; k < nCounts && k < maxLength; k++)
+		{
+			for (size_t j = 0; j < others.size() && k + j < maxLength; j++)
+			{
+				weight[k] += others[j] * ways[k + j];
+			}
+			total += tallies[c].nSolutions[k] * weight[k];
+		}
+		if (total == 0.0)
+		{
+			isConsistent = false;
+			return;
+		}
+		for (size_t i = 0; i < groupIds.size(); i++)
+		{
+			double mineWeight = 0.0;
+			for (size_t k = 0; k < nCounts; k++)
+			{
+				mineWeight += tallies[c].nMineSolutions[i * nCounts + k] * weight[k];
+			}
+			groupProbabilities[groupIds[i]] = mineWeight / total;
+		}
+	}
+	for (size_t cell = 0; cell < frontier.size(); cell++)
+	{
+		probabilities[cell] = groupProbabilities[cellGroups[cell]];
+	}
+
+	const std::vector<double>& all = prefix[nComponents];
+	double total = 0.0;
+	double interiorMines = 0.0;
+	for (size_t k = 0; k < all.size(); k++)
+	{
+		total += all[k] * ways[k];
+		interiorMines += all[k] * ways[k] * double(nMinesLeft - int(k));
+	}
+	if (total == 0.0)
+	{
+		isConsistent = false;
+		return;
+	}
+	interiorProbability = nInterior > 0 ? interiorMines / total / double(nInterior) : 0.0;
+}
+
+bool MineProbability::IsOutOfTime(int nSteps)
+{
+	if (!isComplete) return true;
+	if (deadline == std::chrono::steady_clock::time_point::max()) return false;
+	nStepsToClockCheck -= nSteps;
+	if (nStepsToClockCheck > 0) return false;
+	nStepsToClockCheck = clockCheckInterval;
+	isComplete = std::chrono::steady_clock::now() < deadline;
+	return !isComplete;
+}
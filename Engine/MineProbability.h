@@ -0,0 +1,90 @@
+#pragma once
+#include "Vei2.h"
+#include "MineField.h"
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+// Exact mine probability of every hidden tile given the revealed numbers, the
+// flags (taken to be mines) and the board's total mine count. The frontier
+// (hidden tiles next to a number) is split into components that share no
+// number; each is enumerated on its own, tallying solutions by mine count,
+// and the components are combined with the number of ways to place the
+// remaining mines among the interior tiles. Enumeration is exponential in the
+// size of the largest component, which stays small on expert-sized boards.
+// Given a deadline, the work gives up once the clock passes it and the
+// object is left incomplete.
+class MineProbability
+{
+public:
+	MineProbability(const MineField& field,
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+	// 0 for revealed tiles, 1 for flagged ones
+	double GetProbability(const Vei2& gridPos) const;
+	// shared by every hidden tile that touches no number
+	double GetInteriorProbability() const;
+	const std::vector<Vei2>& GetFrontier() const;
+	const std::vector<double>& GetFrontierProbabilities() const;
+	// false if the numbers and flags admit no mine arrangement at all
+	bool IsConsistent() const;
+	// false if the deadline cut the work short; nothing else is valid then
+	bool IsComplete() const;
+private:
+	struct Constraint
+	{
+		std::vector<int> cells;
+		std::vector<int> groups;
+		int nMines;
+		// enumeration state
+		int nMinesAssigned = 0;
+		int nUnassigned = 0;
+	};
+	// frontier cells touching exactly the same numbers are interchangeable,
+	// so enumeration picks how many mines a group holds, not which cells
+	struct Group
+	{
+		std::vector<int> constraints;
+		int nCells = 0;
+	};
+	// one component's solutions by mine count, scaled so the largest is 1
+	struct Tally
+	{
+		std::vector<double> nSolutions;
+		// per group, expected mines per cell summed over the solutions with
+		// k mines in the component: group * (nCells + 1) + k
+		std::vector<double> nMineSolutions;
+		int nCells = 0;
+	};
+private:
+	void Collect();
+	void BuildGroups();
+	std::vector<std::vector<int>> SplitComponents();
+	Tally Enumerate(const std::vector<int>& groupIds);
+	void Enumerate(const std::vector<int>& groupIds, int i, int nMinesPlaced, double nWays, Tally& tally);
+	bool CanAssign(int group, int nGroupMines) const;
+	void Combine(const std::vector<std::vector<int>>& components, const std::vector<Tally>& tallies);
+	// counts nSteps units of work and reads the clock once every
+	// clockCheckInterval of them, which is far cheaper than a search node
+	bool IsOutOfTime(int nSteps = 1);
+private:
+	static constexpr int clockCheckInterval = 256;
+	// steps that allocate (a constraint, a map entry) count as this many nodes
+	static constexpr int collectStepCost = 16;
+	const MineField& field;
+	int width;
+	int nMinesLeft = 0;
+	long long nInterior = 0;
+	bool isConsistent = true;
+	bool isComplete = true;
+	std::chrono::steady_clock::time_point deadline;
+	int nStepsToClockCheck = clockCheckInterval;
+	double interiorProbability = 0.0;
+	std::vector<Vei2> frontier;
+	std::vector<double> probabilities;
+	std::unordered_map<long long, int> frontierIndex;
+	std::vector<Constraint> constraints;
+	std::vector<Group> groups;
+	std::vector<int> cellGroups;
+	// mines given to each group in the arrangement being enumerated
+	std::vector<int> assignment;
+};
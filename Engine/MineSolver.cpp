@@ -0,0 +1,274 @@
+#include "MineSolver.h"
+#include <assert.h>
+#include <algorithm>
+
+MineSolver::MineSolver(const MineField& field)
+	:
+	field(field),
+	width(field.GetWidth()),
+	height(field.GetHeight()),
+	knownSafe(field.GetWidth(), field.GetHeight()),
+	knownMine(field.GetWidth(), field.GetHeight())
+{
+	// pick up whatever is already visible through the board's constraint index
+	field.GetConstraintTiles().ForEach([this](const Vei2& pos)
+	{
+		RebuildConstraint(pos);
+	});
+	Propagate();
+}
+
+void MineSolver::Update(const std::vector<MineField::TileRun>& changedRuns)
+{
+	// the numbers that can mention a run's tiles are the revealed tiles
+	// around it; each is rebuilt once per run rather than once per tile
+	for (const MineField::TileRun& run : changedRuns)
+	{
+		for (Vei2 pos = { 0, std::max(0, run.y - 1) }; pos.y <= std::min(height - 1, run.y + 1); pos.y++)
+		{
+			for (pos.x = std::max(0, run.xStart - 1); pos.x <= std::min(width - 1, run.xEnd + 1); pos.x++)
+			{
+				if (field.TileAt(pos).IsRevealed())
+				{
+					RebuildConstraint(pos);
+				}
+			}
+		}
+	}
+	Propagate();
+}
+
+bool MineSolver::IsKnownSafe(const Vei2& gridPos) const
+{
+	return knownSafe.Get(gridPos.x, gridPos.y);
+}
+
+bool MineSolver::IsKnownMine(const Vei2& gridPos) const
+{
+	return knownMine.Get(gridPos.x, gridPos.y);
+}
+
+std::vector<Vei2> MineSolver::TakeSafeTiles()
+{
+	// drop the ones revealed in the meantime
+	std::vector<Vei2> tiles;
+	for (const Vei2& pos : newSafeTiles)
+	{
+		if (!field.TileAt(pos).IsRevealed())
+		{
+			tiles.push_back(pos);
+		}
+	}
+	newSafeTiles.clear();
+	return tiles;
+}
+
+std::vector<Vei2> MineSolver::TakeMineTiles()
+{
+	std::vector<Vei2> tiles;
+	tiles.swap(newMineTiles);
+	return tiles;
+}
+
+int MineSolver::GetConstraintCount() const
+{
+	return int(constraints.size());
+}
+
+long long MineSolver::GetKey(const Vei2& gridPos) const
+{
+	return static_cast<long long>(gridPos.y) * width + gridPos.x;
+}
+
+bool MineSolver::IsOpen(const Vei2& gridPos) const
+{
+	return field.TileAt(gridPos).IsHidden() && !knownSafe.Get(gridPos.x, gridPos.y) &&
+		!knownMine.Get(gridPos.x, gridPos.y);
+}
+
+void MineSolver::RebuildAround(const Vei2& gridPos)
+{
+	// the numbers that can mention gridPos are the revealed tiles around it
+	for (Vei2 pos = { std::max(0, gridPos.x - 1), std::max(0, gridPos.y - 1) }; pos.y <= std::min(height - 1, gridPos.y + 1); pos.y++)
+	{
+		for (pos.x = std::max(0, gridPos.x - 1); pos.x <= std::min(width - 1, gridPos.x + 1); pos.x++)
+		{
+			if (field.TileAt(pos).IsRevealed())
+			{
+				RebuildConstraint(pos);
+			}
+		}
+	}
+}
+
+void MineSolver::RebuildConstraint(const Vei2& gridPos)
+{
+	const long long key = GetKey(gridPos);
+	const int nNeighbourMines = field.TileAt(gridPos).GetNeighbourMineCount();
+	if (nNeighbourMines < 0)
+	{
+		// a revealed mine: the game is lost and the tile says nothing
+		constraints.erase(key);
+		return;
+	}
+
+	Constraint constraint;
+	constraint.nMines = nNeighbourMines;
+	for (Vei2 pos = { std::max(0, gridPos.x - 1), std::max(0, gridPos.y - 1) }; pos.y <= std::min(height - 1, gridPos.y + 1); pos.y++)
+	{
+		for (pos.x = std::max(0, gridPos.x - 1); pos.x <= std::min(width - 1, gridPos.x + 1); pos.x++)
+		{
+			const MineField::Tile tile = field.TileAt(pos);
+			if (tile.IsRevealed() || knownSafe.Get(pos.x, pos.y)) continue;
+			if (tile.IsFlagged() || knownMine.Get(pos.x, pos.y))
+			{
+				constraint.nMines--;
+			}
+			else
+			{
+				constraint.cells[constraint.nCells++] = pos;
+			}
+		}
+	}
+
+	if (constraint.nCells == 0)
+	{
+		constraints.erase(key);
+		return;
+	}
+	Constraint& stored = constraints[key];
+	constraint.isQueued = stored.isQueued;
+	stored = constraint;
+	if (!stored.isQueued)
+	{
+		stored.isQueued = true;
+		queue.push_back(gridPos);
+	}
+}
+
+void MineSolver::MarkSafe(const Vei2& gridPos)
+{
+	if (!IsOpen(gridPos)) return;
+	knownSafe.Set(gridPos.x, gridPos.y);
+	newSafeTiles.push_back(gridPos);
+	RebuildAround(gridPos);
+}
+
+void MineSolver::MarkMine(const Vei2& gridPos)
+{
+	if (!IsOpen(gridPos)) return;
+	knownMine.Set(gridPos.x, gridPos.y);
+	newMineTiles.push_back(gridPos);
+	RebuildAround(gridPos);
+}
+
+void MineSolver::MarkGroup(const Vei2* cells, int nCells, int minMines, int maxMines)
+{
+	if (nCells == 0) return;
+	if (maxMines == 0)
+	{
+		for (int i = 0; i < nCells; i++)
+		{
+			MarkSafe(cells[i]);
+		}
+	}
+	else if (minMines == nCells)
+	{
+		for (int i = 0; i < nCells; i++)
+		{
+			MarkMine(cells[i]);
+		}
+	}
+}
+
+void MineSolver::Propagate()
+{
+	while (!queue.empty())
+	{
+		const Vei2 pos = queue.back();
+		queue.pop_back();
+		Deduce(pos);
+	}
+}
+
+void MineSolver::Deduce(const Vei2& gridPos)
+{
+	const auto it = constraints.find(GetKey(gridPos));
+	if (it == constraints.end()) return;
+	it->second.isQueued = false;
+	// marking tiles rebuilds (or erases) constraints, so work on copies; a
+	// copy that went stale still states a true fact about its cells
+	const Constraint constraint = it->second;
+	// wrong flags can make a number unsatisfiable: nothing sound follows
+	if (constraint.nMines < 0 || constraint.nMines > constraint.nCells) return;
+
+	if (constraint.nMines == 0 || constraint.nMines == constraint.nCells)
+	{
+		MarkGroup(constraint.cells, constraint.nCells, constraint.nMines, constraint.nMines);
+		return;
+	}
+
+	// only numbers within two tiles can share a hidden neighbour
+	for (Vei2 pos = { std::max(0, gridPos.x - 2), std::max(0, gridPos.y - 2) }; pos.y <= std::min(height - 1, gridPos.y + 2); pos.y++)
+	{
+		for (pos.x = std::max(0, gridPos.x - 2); pos.x <= std::min(width - 1, gridPos.x + 2); pos.x++)
+		{
+			if (pos.x == gridPos.x && pos.y == gridPos.y) continue;
+			const auto other = constraints.find(GetKey(pos));
+			if (other != constraints.end())
+			{
+				const Constraint otherConstraint = other->second;
+				DeducePair(constraint, otherConstraint);
+			}
+		}
+	}
+}
+
+void MineSolver::DeducePair(const Constraint& a, const Constraint& b)
+{
+	if (b.nMines < 0 || b.nMines > b.nCells) return;
+
+	Vei2 aOnly[8];
+	Vei2 bOnly[8];
+	Vei2 shared[8];
+	int nAOnly = 0;
+	int nBOnly = 0;
+	int nShared = 0;
+	for (int i = 0; i < a.nCells; i++)
+	{
+		const bool isShared = std::any_of(b.cells, b.cells + b.nCells, [&](const Vei2& cell)
+		{
+			return cell.x == a.cells[i].x && cell.y == a.cells[i].y;
+		});
+		if (isShared)
+		{
+			shared[nShared++] = a.cells[i];
+		}
+		else
+		{
+			aOnly[nAOnly++] = a.cells[i];
+		}
+	}
+	if (nShared == 0) return;
+	for (int i = 0; i < b.nCells; i++)
+	{
+		const bool isShared = std::any_of(shared, shared + nShared, [&](const Vei2& cell)
+		{
+			return cell.x == b.cells[i].x && cell.y == b.cells[i].y;
+		});
+		if (!isShared)
+		{
+			bOnly[nBOnly++] = b.cells[i];
+		}
+	}
+
+	// bounds on the mines in the shared cells that both numbers allow; the
+	// subset rule is the case where one side has no cells of its own
+	const int sharedMin = std::max({ 0, a.nMines - nAOnly, b.nMines - nBOnly });
+	const int sharedMax = std::min({ nShared, a.nMines, b.nMines });
+	if (sharedMin > sharedMax) return;
+
+	MarkGroup(shared, nShared, sharedMin, sharedMax);
+	MarkGroup(aOnly, nAOnly, a.nMines - sharedMax, a.nMines - sharedMin);
+	MarkGroup(bOnly, nBOnly, b.nMines - sharedMax, b.nMines - sharedMin);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "Vei2.h"
+#include "BitGrid.h"
+#include "MineField.h"
+#include <unordered_map>
+#include <vector>
+
+// Deterministic deductions over a MineField's visible state: single-point
+// (a number whose hidden neighbours are all safe or all mines) and pairwise
+// subset/overlap reasoning between neighbouring numbers. Flags are taken to
+// be mines. The constraint set is kept between moves and only the numbers
+// around changed tiles are rebuilt, so call Update with
+// MineField::GetLastChangedRuns() after every reveal or flag click.
+class MineSolver
+{
+public:
+	MineSolver(const MineField& field);
+	void Update(const std::vector<MineField::TileRun>& changedRuns);
+	bool IsKnownSafe(const Vei2& gridPos) const;
+	bool IsKnownMine(const Vei2& gridPos) const;
+	// deductions made since the last call, for the caller to reveal / flag
+	std::vector<Vei2> TakeSafeTiles();
+	std::vector<Vei2> TakeMineTiles();
+	int GetConstraintCount() const;
+private:
+	// one revealed number and the neighbours it still says something about
+	struct Constraint
+	{
+		Vei2 cells[8];
+		int nCells = 0;
+		// mines among cells: the number minus flagged / known mine neighbours
+		int nMines = 0;
+		bool isQueued = false;
+	};
+private:
+	long long GetKey(const Vei2& gridPos) const;
+	// tiles still undecided: hidden, not flagged, not yet deduced either way
+	bool IsOpen(const Vei2& gridPos) const;
+	void RebuildAround(const Vei2& gridPos);
+	void RebuildConstraint(const Vei2& gridPos);
+	void MarkSafe(const Vei2& gridPos);
+	void MarkMine(const Vei2& gridPos);
+	// a group of cells known to hold between minMines and maxMines mines
+	void MarkGroup(const Vei2* cells, int nCells, int minMines, int maxMines);
+	// runs queued constraints until no new deduction comes out
+	void Propagate();
+	void Deduce(const Vei2& gridPos);
+	void DeducePair(const Constraint& a, const Constraint& b);
+private:
+	const MineField& field;
+	int width;
+	int height;
+	BitGrid knownSafe;
+	BitGrid knownMine;
+	std::unordered_map<long long, Constraint> constraints;
+	std::vector<Vei2> queue;
+	std::vector<Vei2> newSafeTiles;
+	std::vector<Vei2> newMineTiles;
+};
@@ -0,0 +1,246 @@
+#include "MoveAdvisor.h"
+#include "MineProbability.h"
+#include <assert.h>
+#include <algorithm>
+
+constexpr int MoveAdvisor::tilesPerClockCheck;
+
+MoveAdvisor::MoveAdvisor(const MineField& field)
+	:
+	field(field),
+	solver(field)
+{
+}
+
+void MoveAdvisor::Update(const std::vector<MineField::TileRun>& changedRuns)
+{
+	solver.Update(changedRuns);
+	for (const Vei2& pos : solver.TakeSafeTiles())
+	{
+		safeTiles.push_back(pos);
+	}
+	solver.TakeMineTiles();
+	// an unflagged tile can rejoin the interior, so the scan starts over
+	nInteriorTilesSkipped = 0;
+}
+
+MoveAdvisor::Hint MoveAdvisor::Suggest(std::chrono::steady_clock::duration budget)
+{
+	assert(field.GetGameState() == MineField::GameState::Playing);
+	const Clock::time_point deadline = Clock::now() + budget;
+	if (!field.IsGenerated())
+	{
+		// the first reveal never hits a mine; the centre leaves the most room
+		// for an opening unless it has been flagged
+		Hint hint = { { field.GetWidth() / 2, field.GetHeight() / 2 }, 0.0, Hint::Source::FirstClick };
+		if (!field.TileAt(hint.gridPos).IsHidden())
+		{
+			hint.gridPos = FindAnyClosedTile(deadline).gridPos;
+		}
+		return hint;
+	}
+	Vei2 safePos;
+	if (FindSafeTile(safePos))
+	{
+		return { safePos, 0.0, Hint::Source::Deduction };
+	}
+
+	Hint best = { { -1, -1 }, 2.0, Hint::Source::LocalEstimate };
+	if (FindInteriorTile(deadline))
+	{
+		best = { interiorCursor, GetInteriorDensity(), Hint::Source::LocalEstimate };
+	}
+	if (EstimateLocally(deadline, best))
+	{
+		ComputeExactly(deadline, best);
+	}
+	return best.gridPos.x >= 0 ? best : FindAnyClosedTile(deadline);
+}
+
+bool MoveAdvisor::IsCandidate(const Vei2& gridPos) const
+{
+	return field.TileAt(gridPos).IsHidden() && !solver.IsKnownMine(gridPos);
+}
+
+bool MoveAdvisor::FindSafeTile(Vei2& gridPos)
+{
+	// tiles revealed since they were deduced are dropped here; the suggested
+	// one stays until the player takes it
+	while (!safeTiles.empty())
+	{
+		if (field.TileAt(safeTiles.back()).IsHidden())
+		{
+			gridPos = safeTiles.back();
+			return true;
+		}
+		safeTiles.pop_back();
+	}
+	return false;
+}
+
+bool MoveAdvisor::FindInteriorTile(Clock::time_point deadline)
+{
+	const int width = field.GetWidth();
+	const int height = field.GetHeight();
+	const long long nTiles = static_cast<long long>(width) * height;
+	while (nInteriorTilesSkipped < nTiles)
+	{
+		if (IsCandidate(interiorCursor) && !field.GetFrontier().Contains(interiorCursor))
+		{
+			return true;
+		}
+		nInteriorTilesSkipped++;
+		if (++interiorCursor.x == width)
+		{
+			interiorCursor.x = 0;
+			if (++interiorCursor.y == height)
+			{
+				interiorCursor.y = 0;
+			}
+		}
+		if (nInteriorTilesSkipped % tilesPerClockCheck == 0 && Clock::now() >= deadline)
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+double MoveAdvisor::GetInteriorDensity() const
+{
+	// while playing, the closed tiles are the unrevealed safe ones and the
+	// mines, less the flags
+	const long long nClosed = field.GetMineCount() + field.GetSafeTilesLeft() - field.GetFlagCount();
+	const long long nMinesLeft = field.GetMineCount() - field.GetFlagCount();
+	return nClosed > 0 ? std::min(1.0, std::max(0.0, double(nMinesLeft) / double(nClosed))) : 0.0;
+}
+
+double MoveAdvisor::EstimateTile(const Vei2& gridPos) const
+{
+	const int width = field.GetWidth();
+	const int height = field.GetHeight();
+	double estimate = -1.0;
+	for (Vei2 number = { std::max(0, gridPos.x - 1), std::max(0, gridPos.y - 1) }; number.y <= std::min(height - 1, gridPos.y + 1); number.y++)
+	{
+		for (number.x = std::max(0, gridPos.x - 1); number.x <= std::min(width - 1, gridPos.x + 1); number.x++)
+		{
+			const MineField::Tile numberTile = field.TileAt(number);
+			if (!numberTile.IsRevealed()) continue;
+			int nMines = numberTile.GetNeighbourMineCount();
+			int nClosed = 0;
+			for (Vei2 other = { std::max(0, number.x - 1), std::max(0, number.y - 1) }; other.y <= std::min(height - 1, number.y + 1); other.y++)
+			{
+				for (other.x = std::max(0, number.x - 1); other.x <= std::min(width - 1, number.x + 1); other.x++)
+				{
+					const MineField::Tile otherTile = field.TileAt(other);
+					if (otherTile.IsFlagged() || (otherTile.IsHidden() && solver.IsKnownMine(other)))
+					{
+						nMines--;
+					}
+					else if (otherTile.IsHidden())
+					{
+						nClosed++;
+					}
+				}
+			}
+			assert(nClosed > 0);
+			estimate = std::max(estimate, std::min(1.0, std::max(0.0, double(nMines) / nClosed)));
+		}
+	}
+	return estimate < 0.0 ? GetInteriorDensity() : estimate;
+}
+
+bool MoveAdvisor::EstimateLocally(Clock::time_point deadline, Hint& best) const
+{
+	int nTilesToClockCheck = tilesPerClockCheck;
+	return field.GetFrontier().ForEachWhile([&](const Vei2& pos)
+	{
+		if (--nTilesToClockCheck == 0)
+		{
+			nTilesToClockCheck = tilesPerClockCheck;
+			if (Clock::now() >= deadline) return false;
+		}
+		if (!solver.IsKnownMine(pos))
+		{
+			const double estimate = EstimateTile(pos);
+			if (estimate < best.mineProbability)
+			{
+				best = { pos, estimate, Hint::Source::LocalEstimate };
+			}
+		}
+		return true;
+	});
+}
+
+bool MoveAdvisor::ComputeExactly(Clock::time_point deadline, Hint& best) const
+{
+	// freeing what an abandoned run built takes time too, up to about half
+	// as long again, so it only gets part of what is left
+	const Clock::time_point start = Clock::now();
+	if (start >= deadline) return false;
+	const MineProbability probability(field, start + (deadline - start) * 2 / 3);
+	if (!probability.IsComplete()) return false;
+	// contradictory flags: the local estimate is all there is to go on
+	if (!probability.IsConsistent()) return true;
+
+	Hint exact = { { -1, -1 }, 2.0, Hint::Source::ExactProbability };
+	if (nInteriorTilesSkipped < static_cast<long long>(field.GetWidth()) * field.GetHeight() &&
+		IsCandidate(interiorCursor) && !field.GetFrontier().Contains(interiorCursor))
+	{
+		exact.gridPos = interiorCursor;
+		exact.mineProbability = probability.GetInteriorProbability();
+	}
+	const std::vector<Vei2>& frontier = probability.GetFrontier();
+	const std::vector<double>& probabilities = probability.GetFrontierProbabilities();
+	for (size_t i = 0; i < frontier.size(); i++)
+	{
+		if (probabilities[i] < exact.mineProbability && !solver.IsKnownMine(frontier[i]))
+		{
+			exact = { frontier[i], probabilities[i], Hint::Source::ExactProbability };
+		}
+	}
+	if (exact.gridPos.x >= 0)
+	{
+		best = exact;
+	}
+	return true;
+}
+
+MoveAdvisor::Hint MoveAdvisor::FindAnyClosedTile(Clock::time_point deadline)
+{
+	Hint hint = { { -1, -1 }, GetInteriorDensity(), Hint::Source::AnyClosedTile };
+	// wrong flags can have the solver take every frontier tile for a mine; a
+	// hidden tile is still better than nothing, so the first one is kept
+	Vei2 knownMine = { -1, -1 };
+	int nTilesToClockCheck = tilesPerClockCheck;
+	const bool isFrontierDone = field.GetFrontier().ForEachWhile([&](const Vei2& pos)
+	{
+		if (--nTilesToClockCheck == 0)
+		{
+			nTilesToClockCheck = tilesPerClockCheck;
+			if (Clock::now() >= deadline) return false;
+		}
+		if (solver.IsKnownMine(pos))
+		{
+			if (knownMine.x < 0)
+			{
+				knownMine = pos;
+			}
+			return true;
+		}
+		hint.gridPos = pos;
+		return false;
+	});
+	if (hint.gridPos.x >= 0 || !isFrontierDone) return hint;
+	// the interior scan keeps its place between calls, so on a board too big
+	// to scan in one budget later calls carry on from here
+	if (FindInteriorTile(deadline))
+	{
+		hint.gridPos = interiorCursor;
+	}
+	else if (nInteriorTilesSkipped >= static_cast<long long>(field.GetWidth()) * field.GetHeight())
+	{
+		hint.gridPos = knownMine;
+	}
+	return hint;
+}
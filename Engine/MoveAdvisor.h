@@ -0,0 +1,73 @@
+#pragma once
+#include "Vei2.h"
+#include "MineField.h"
+#include "MineSolver.h"
+#include <chrono>
+#include <vector>
+
+// Anytime "best next move" for a game in progress. Suggest works through
+// ever more expensive stages until its time budget runs out and returns the
+// best answer found so far:
+//  1. a tile MineSolver has proven safe (kept current by Update, so free)
+//  2. a local estimate: for a frontier tile, the highest share of remaining
+//     mines among the closed neighbours of any number around it; for the
+//     rest, the mines left over the closed tiles left
+//  3. the exact probabilities of MineProbability, given the deadline
+// Stages 2 and 3, and the search for a fallback tile, read the clock as they
+// go, so a call overruns its budget by microseconds at most whatever the
+// board, and a game loop can ask every frame. A budget too short for any
+// estimate still gets some hidden tile if one turns up in time.
+class MoveAdvisor
+{
+public:
+	struct Hint
+	{
+		enum class Source
+		{
+			FirstClick,
+			Deduction,
+			LocalEstimate,
+			ExactProbability,
+			// the budget ran out before anything was compared
+			AnyClosedTile
+		};
+		Vei2 gridPos;
+		double mineProbability;
+		Source source;
+	};
+public:
+	MoveAdvisor(const MineField& field);
+	// call with MineField::GetLastChangedRuns() after every reveal or flag click
+	void Update(const std::vector<MineField::TileRun>& changedRuns);
+	// only while the game is being played; gridPos is (-1, -1) if no tile is
+	// left to suggest, i.e. every closed tile is flagged, or if the budget ran
+	// out before one was found (the search resumes where it stopped next call)
+	Hint Suggest(std::chrono::steady_clock::duration budget);
+private:
+	using Clock = std::chrono::steady_clock;
+	// hidden, not known to be a mine
+	bool IsCandidate(const Vei2& gridPos) const;
+	bool FindSafeTile(Vei2& gridPos);
+	// moves interiorCursor to a candidate off the frontier; false if the
+	// deadline passes first or the board has none
+	bool FindInteriorTile(Clock::time_point deadline);
+	double GetInteriorDensity() const;
+	double EstimateTile(const Vei2& gridPos) const;
+	// both return false if the deadline cut them short
+	bool EstimateLocally(Clock::time_point deadline, Hint& best) const;
+	bool ComputeExactly(Clock::time_point deadline, Hint& best) const;
+	// a frontier tile, else an interior one, else a tile the solver takes
+	// for a mine; gives up at the deadline
+	Hint FindAnyClosedTile(Clock::time_point deadline);
+private:
+	// frontier tiles looked at between clock reads
+	static constexpr int tilesPerClockCheck = 64;
+	const MineField& field;
+	MineSolver solver;
+	std::vector<Vei2> safeTiles;
+	// row-major scan position, kept between calls so the interior is not
+	// searched from the top every time, and the tiles passed over since the
+	// last Update; once that covers the board there is no interior left
+	Vei2 interiorCursor = { 0, 0 };
+	long long nInteriorTilesSkipped = 0;
+};
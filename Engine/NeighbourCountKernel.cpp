@@ -0,0 +1,193 @@
+#include "NeighbourCountKernel.h"
+#include "Parallel.h"
+#include <assert.h>
+#include <vector>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MINEFIELD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(MINEFIELD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MINEFIELD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MINEFIELD_TARGET_AVX2
+#endif
+
+void NeighbourCountKernel::Compute(const BitGrid& mines, NibbleGrid& counts, Path path, int nThreads)
+{
+	assert(counts.GetWidth() == mines.GetWidth() && counts.GetHeight() == mines.GetHeight());
+	if (path == Path::Auto)
+	{
+		path = IsAvx2Supported() ? Path::Avx2 : Path::Scalar;
+	}
+	assert(path != Path::Avx2 || IsAvx2Supported());
+
+	const int height = mines.GetHeight();
+	const int blockRows = std::max(1, blockTiles / mines.GetWidth());
+	const int nBlocks = (height + blockRows - 1) / blockRows;
+	ParallelFor(nBlocks, nThreads, [&](int block)
+	{
+		ComputeRows(mines, counts, path, block * blockRows, std::min(height, (block + 1) * blockRows));
+	});
+}
+
+void NeighbourCountKernel::ComputeRows(const BitGrid& mines, NibbleGrid& counts, Path path, int yBegin, int yEnd)
+{
+	const int width = mines.GetWidth();
+	const int height = mines.GetHeight();
+	const int nNibbleWords = counts.GetWordsPerRow();
+	// expanded rows carry one zero word of padding on each side so the
+	// horizontal pass can read word k-1 and k+1 without edge cases
+	const int paddedWords = nNibbleWords + 2;
+	std::vector<uint64_t> buffer(size_t(paddedWords) * 4, 0u);
+	uint64_t* above = &buffer[0];
+	uint64_t* row = &buffer[paddedWords];
+	uint64_t* below = &buffer[2 * paddedWords];
+	uint64_t* columnSums = &buffer[3 * paddedWords];
+
+	const int tailNibbles = width & 15;
+	const uint64_t tailMask = tailNibbles == 0 ? ~uint64_t(0) : (uint64_t(1) << (tailNibbles * 4)) - 1u;
+
+	// 'above' stays the all-zero row when the block starts at the top edge
+	if (yBegin > 0)
+	{
+		ExpandRow(mines, yBegin - 1, above + 1, nNibbleWords);
+	}
+	ExpandRow(mines, yBegin, row + 1, nNibbleWords);
+	for (int y = yBegin; y < yEnd; y++)
+	{
+		if (y + 1 < height)
+		{
+			ExpandRow(mines, y + 1, below + 1, nNibbleWords);
+		}
+		else
+		{
+			std::fill(below + 1, below + 1 + nNibbleWords, uint64_t(0));
+		}
+		uint64_t* out = counts.Row(y);
+		if (path == Path::Avx2)
+		{
+			SumRowsAvx2(above + 1, row + 1, below + 1, columnSums + 1, nNibbleWords);
+			SumColumnsAvx2(columnSums + 1, row + 1, out, nNibbleWords);
+		}
+		else
+		{
+			SumRowsScalar(above + 1, row + 1, below + 1, columnSums + 1, nNibbleWords);
+			SumColumnsScalar(columnSums + 1, row + 1, out, nNibbleWords);
+		}
+		out[nNibbleWords - 1] &= tailMask;
+
+		// rotate the three row buffers, the old 'above' becomes the next 'below'
+		uint64_t* const recycled = above;
+		above = row;
+		row = below;
+		below = recycled;
+	}
+}
+
+bool NeighbourCountKernel::IsAvx2Supported()
+{
+#if defined(MINEFIELD_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) return false;
+	__cpuid(info, 1);
+	const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+	__cpuidex(info, 7, 0);
+	return osSavesYmm && (info[1] & (1 << 5)) != 0;
+#elif defined(MINEFIELD_X86) && (defined(__GNUC__) || defined(__clang__))
+	return __builtin_cpu_supports("avx2") != 0;
+#else
+	return false;
+#endif
+}
+
+void NeighbourCountKernel::ExpandRow(const BitGrid& mines, int y, uint64_t* nibbles, int nNibbleWords)
+{
+	// spread each 16-bit slice of the mine row so bit i lands in bit 4*i
+	const uint64_t* mineRow = mines.Row(y);
+	for (int k = 0; k < nNibbleWords; k++)
+	{
+		uint64_t t = (mineRow[k >> 2] >> ((k & 3) * 16)) & 0xFFFFu;
+		t = (t | (t << 24)) & 0x000000FF000000FFull;
+		t = (t | (t << 12)) & 0x000F000F000F000Full;
+		t = (t | (t << 6)) & 0x0303030303030303ull;
+		t = (t | (t << 3)) & 0x1111111111111111ull;
+		nibbles[k] = t;
+	}
+}
+
+void NeighbourCountKernel::SumRowsScalar(const uint64_t* above, const uint64_t* row, const uint64_t* below,
+	uint64_t* out, int nNibbleWords)
+{
+	// each nibble is at most 3 afterwards, so lanes never carry into each other
+	for (int k = 0; k < nNibbleWords; k++)
+	{
+		out[k] = above[k] + row[k] + below[k];
+	}
+}
+
+void NeighbourCountKernel::SumColumnsScalar(const uint64_t* columnSums, const uint64_t* row, uint64_t* out, int nNibbleWords)
+{
+	// left + centre + right column sums (at most 9 per nibble), minus the tile itself;
+	// columnSums[-1] and columnSums[nNibbleWords] are the zero padding words
+	for (int k = 0; k < nNibbleWords; k++)
+	{
+		const uint64_t centre = columnSums[k];
+		const uint64_t left = (centre << 4) | (columnSums[k - 1] >> 60);
+		const uint64_t right = (centre >> 4) | (columnSums[k + 1] << 60);
+		out[k] = centre + left + right - row[k];
+	}
+}
+
+#if defined(MINEFIELD_X86)
+MINEFIELD_TARGET_AVX2
+void NeighbourCountKernel::SumRowsAvx2(const uint64_t* above, const uint64_t* row, const uint64_t* below,
+	uint64_t* out, int nNibbleWords)
+{
+	int k = 0;
+	for (; k + 4 <= nNibbleWords; k += 4)
+	{
+		const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(above + k));
+		const __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + k));
+		const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + k));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_add_epi64(_mm256_add_epi64(a, r), b));
+	}
+	SumRowsScalar(above + k, row + k, below + k, out + k, nNibbleWords - k);
+}
+
+MINEFIELD_TARGET_AVX2
+void NeighbourCountKernel::SumColumnsAvx2(const uint64_t* columnSums, const uint64_t* row, uint64_t* out, int nNibbleWords)
+{
+	int k = 0;
+	for (; k + 4 <= nNibbleWords; k += 4)
+	{
+		const __m256i centre = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columnSums + k));
+		const __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columnSums + k - 1));
+		const __m256i next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columnSums + k + 1));
+		const __m256i self = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + k));
+		const __m256i left = _mm256_or_si256(_mm256_slli_epi64(centre, 4), _mm256_srli_epi64(previous, 60));
+		const __m256i right = _mm256_or_si256(_mm256_srli_epi64(centre, 4), _mm256_slli_epi64(next, 60));
+		const __m256i sum = _mm256_add_epi64(_mm256_add_epi64(centre, left), right);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_sub_epi64(sum, self));
+	}
+	// the scalar tail still reads columnSums[k - 1] from the vector part
+	SumColumnsScalar(columnSums + k, row + k, out + k, nNibbleWords - k);
+}
+#else
+void NeighbourCountKernel::SumRowsAvx2(const uint64_t* above, const uint64_t* row, const uint64_t* below,
+	uint64_t* out, int nNibbleWords)
+{
+	SumRowsScalar(above, row, below, out, nNibbleWords);
+}
+
+void NeighbourCountKernel::SumColumnsAvx2(const uint64_t* columnSums, const uint64_t* row, uint64_t* out, int nNibbleWords)
+{
+	SumColumnsScalar(columnSums, row, out, nNibbleWords);
+}
+#endif
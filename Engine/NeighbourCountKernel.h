@@ -0,0 +1,35 @@
+#pragma once
+#include "BitGrid.h"
+#include "NibbleGrid.h"
+
+// Computes every tile's neighbour mine count in one pass over a packed mine
+// plane. Mine rows are widened to one nibble per tile and summed with
+// shifted-row adds (three rows vertically, then the word shifted one nibble
+// left and right), sixteen tiles per 64-bit word or 64 per AVX2 register.
+// Counts for mine tiles exclude the mine itself; padding nibbles stay zero.
+// Row blocks are independent, so big boards are split across threads.
+class NeighbourCountKernel
+{
+public:
+	enum class Path
+	{
+		Auto,
+		Scalar,
+		Avx2
+	};
+public:
+	static void Compute(const BitGrid& mines, NibbleGrid& counts, Path path = Path::Auto, int nThreads = 1);
+	static bool IsAvx2Supported();
+private:
+	static void ComputeRows(const BitGrid& mines, NibbleGrid& counts, Path path, int yBegin, int yEnd);
+	static void ExpandRow(const BitGrid& mines, int y, uint64_t* nibbles, int nNibbleWords);
+	static void SumRowsScalar(const uint64_t* above, const uint64_t* row, const uint64_t* below,
+		uint64_t* out, int nNibbleWords);
+	static void SumRowsAvx2(const uint64_t* above, const uint64_t* row, const uint64_t* below,
+		uint64_t* out, int nNibbleWords);
+	static void SumColumnsScalar(const uint64_t* columnSums, const uint64_t* row, uint64_t* out, int nNibbleWords);
+	static void SumColumnsAvx2(const uint64_t* columnSums, const uint64_t* row, uint64_t* out, int nNibbleWords);
+private:
+	// rows handed to one thread at a time, roughly a million tiles
+	static constexpr int blockTiles = 1 << 20;
+};
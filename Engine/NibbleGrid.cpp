@@ -0,0 +1,32 @@
+#include "NibbleGrid.h"
+#include <assert.h>
+
+NibbleGrid::NibbleGrid(int width, int height)
+	:
+	width(width),
+	height(height),
+	wordsPerRow((width + 15) / 16),
+	words(size_t(wordsPerRow) * height, 0u)
+{
+	assert(width > 0 && height > 0);
+}
+
+int NibbleGrid::GetWidth() const
+{
+	return width;
+}
+
+int NibbleGrid::GetHeight() const
+{
+	return height;
+}
+
+int NibbleGrid::GetWordsPerRow() const
+{
+	return wordsPerRow;
+}
+
+size_t NibbleGrid::GetMemoryBytes() const
+{
+	return words.size() * sizeof(uint64_t);
+}
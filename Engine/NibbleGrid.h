@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Four bits per tile (values 0-15), row-major, sixteen tiles per 64-bit word.
+// Rows start on a fresh word like BitGrid so the two can be walked together.
+class NibbleGrid
+{
+public:
+	NibbleGrid(int width, int height);
+	int Get(int x, int y) const
+	{
+		return int((Row(y)[x >> 4] >> ((x & 15) * 4)) & 0xFu);
+	}
+	void Set(int x, int y, int value)
+	{
+		uint64_t& word = Row(y)[x >> 4];
+		const int shift = (x & 15) * 4;
+		word = (word & ~(uint64_t(0xF) << shift)) | (uint64_t(value & 0xF) << shift);
+	}
+	uint64_t* Row(int y)
+	{
+		return &words[size_t(y) * wordsPerRow];
+	}
+	const uint64_t* Row(int y) const
+	{
+		return &words[size_t(y) * wordsPerRow];
+	}
+	int GetWidth() const;
+	int GetHeight() const;
+	int GetWordsPerRow() const;
+	size_t GetMemoryBytes() const;
+private:
+	int width;
+	int height;
+	int wordsPerRow;
+	std::vector<uint64_t> words;
+};
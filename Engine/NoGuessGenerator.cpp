@@ -0,0 +1,98 @@
+#include "NoGuessGenerator.h"
+#include "MineField.h"
+#include "MineSolver.h"
+#include "Parallel.h"
+#include <assert.h>
+#include <algorithm>
+#include <thread>
+
+constexpr uint64_t NoGuessGenerator::defaultMaxAttempts;
+
+std::vector<uint64_t> NoGuessGenerator::FindSeeds(int nBoards, int width, int height, int nMines, const Vei2& safePos,
+	uint64_t firstSeed, int nThreads, uint64_t maxAttempts)
+{
+	assert(nBoards >= 0);
+	assert(maxAttempts > 0);
+	if (nThreads <= 0)
+	{
+		nThreads = int(std::max(1u, std::thread::hardware_concurrency()));
+	}
+	const int nCandidates = nThreads * candidatesPerThread;
+
+	std::vector<uint64_t> seeds;
+	std::vector<char> isSolvable(nCandidates);
+	// candidates from endSeed on are past the attempt cap; it moves on with
+	// every accepted seed. A batch never runs past it, so the seeds tried do
+	// not depend on the thread count either.
+	uint64_t endSeed = firstSeed + maxAttempts;
+	for (uint64_t batchSeed = firstSeed; int(seeds.size()) < nBoards && batchSeed < endSeed;)
+	{
+		const int batchSize = int(std::min<uint64_t>(nCandidates, endSeed - batchSeed));
+		// each board is generated single-threaded; the parallelism is across candidates
+		ParallelFor(batchSize, nThreads, [&](int i)
+		{
+			isSolvable[i] = IsSolvable(width, height, nMines, batchSeed + i, safePos);
+		});
+		for (int i = 0; i < batchSize && int(seeds.size()) < nBoards; i++)
+		{
+			if (isSolvable[i])
+			{
+				seeds.push_back(batchSeed + i);
+				endSeed = batchSeed + i + 1 + maxAttempts;
+			}
+		}
+		batchSeed += batchSize;
+	}
+	return seeds;
+}
+
+bool NoGuessGenerator::FindSeed(int width, int height, int nMines, const Vei2& safePos, uint64_t firstSeed, uint64_t& seed,
+	int nThreads, uint64_t maxAttempts)
+{
+	const std::vector<uint64_t> seeds = FindSeeds(1, width, height, nMines, safePos, firstSeed, nThreads, maxAttempts);
+	if (seeds.empty()) return false;
+	seed = seeds.front();
+	return true;
+}
+
+bool NoGuessGenerator::IsSolvable(int width, int height, int nMines, uint64_t seed, const Vei2& safePos)
+{
+	MineField field(width, height, nMines, seed, 1);
+	MineSolver solver(field);
+	field.OnRevealClick(safePos);
+	solver.Update(field.GetLastChangedRuns());
+	while (field.GetGameState() == MineField::GameState::Playing)
+	{
+		std::vector<Vei2> safeTiles = solver.TakeSafeTiles();
+		if (safeTiles.empty())
+		{
+			// local deduction is stuck; the mine total settles it only when
+			// every remaining mine is already known, otherwise reject now
+			std::vector<Vei2> undecided;
+			int nKnownMines = 0;
+			for (Vei2 pos = { 0, 0 }; pos.y < height; pos.y++)
+			{
+				for (pos.x = 0; pos.x < width; pos.x++)
+				{
+					if (field.TileAt(pos).IsRevealed()) continue;
+					if (solver.IsKnownMine(pos))
+					{
+						nKnownMines++;
+					}
+					else
+					{
+						undecided.push_back(pos);
+					}
+				}
+			}
+			if (nKnownMines < nMines) return false;
+			safeTiles.swap(undecided);
+		}
+		for (const Vei2& pos : safeTiles)
+		{
+			field.OnRevealClick(pos);
+			solver.Update(field.GetLastChangedRuns());
+		}
+	}
+	return field.GetGameState() == MineField::GameState::Win;
+}
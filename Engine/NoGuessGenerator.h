@@ -0,0 +1,30 @@
+#pragma once
+#include "Vei2.h"
+#include <cstdint>
+#include <vector>
+
+// Picks seeds whose boards can be cleared by pure deduction. A MineField is
+// fully determined by (size, mines, seed, first click), so a no-guess board is
+// MineField(width, height, nMines, seed) opened at safePos with a seed from
+// here. Candidate seeds are played out with MineSolver in parallel batches and
+// dropped at the first position where no safe tile can be deduced; the
+// accepted seeds are the same whatever the thread count.
+class NoGuessGenerator
+{
+public:
+	// The first nBoards solvable seeds at or after firstSeed. Gives up once
+	// maxAttempts candidates in a row fail (at densities where deduction
+	// alone almost never clears a board), returning the seeds found so far.
+	static std::vector<uint64_t> FindSeeds(int nBoards, int width, int height, int nMines, const Vei2& safePos,
+		uint64_t firstSeed, int nThreads = 0, uint64_t maxAttempts = defaultMaxAttempts);
+	// false if no solvable seed was found within maxAttempts candidates
+	static bool FindSeed(int width, int height, int nMines, const Vei2& safePos, uint64_t firstSeed, uint64_t& seed,
+		int nThreads = 0, uint64_t maxAttempts = defaultMaxAttempts);
+	static bool IsSolvable(int width, int height, int nMines, uint64_t seed, const Vei2& safePos);
+public:
+	static constexpr uint64_t defaultMaxAttempts = 1 << 16;
+private:
+	// candidates each thread plays per round; small enough that a single
+	// board does not wait on many wasted candidates
+	static constexpr int candidatesPerThread = 8;
+};
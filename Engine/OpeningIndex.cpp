@@ -0,0 +1,246 @@
+#include "OpeningIndex.h"
+#include <assert.h>
+#include <algorithm>
+
+namespace
+{
+	// union-find over run indices: the parent, or -1 for a root
+	int FindRoot(std::vector<int>& parents, int i)
+	{
+		while (parents[i] >= 0)
+		{
+			if (parents[parents[i]] >= 0)
+			{
+				parents[i] = parents[parents[i]];
+			}
+			i = parents[i];
+		}
+		return i;
+	}
+
+	// one bit per zero nibble of a NibbleGrid word, packed into the low 16 bits
+	uint64_t GetZeroNibbles(uint64_t word)
+	{
+		uint64_t nonZero = word | (word >> 1);
+		nonZero |= nonZero >> 2;
+		uint64_t bits = ~nonZero & 0x1111111111111111ull;
+		bits = (bits | (bits >> 3)) & 0x0303030303030303ull;
+		bits = (bits | (bits >> 6)) & 0x000F000F000F000Full;
+		bits = (bits | (bits >> 12)) & 0x000000FF000000FFull;
+		return (bits | (bits >> 24)) & 0xFFFFull;
+	}
+}
+
+OpeningIndex::ZeroRuns::ZeroRuns(int width, int height)
+	:
+	zeros(width, height)
+{
+}
+
+void OpeningIndex::FindZeroRuns(const BitGrid& mines, const NibbleGrid& neighbourCounts, ZeroRuns& zeroRuns)
+{
+	const int height = mines.GetHeight();
+	const int wordsPerRow = mines.GetWordsPerRow();
+	const int countWordsPerRow = neighbourCounts.GetWordsPerRow();
+	std::vector<Span>& runs = zeroRuns.runs;
+	std::vector<size_t>& rowStarts = zeroRuns.rowStarts;
+	runs.clear();
+	rowStarts.assign(1, 0);
+	std::vector<int> parents;
+
+	// zero tiles come out 64 at a time, are cut into row runs, and each run
+	// joins the runs it touches in the row above
+	for (int y = 0; y < height; y++)
+	{
+		const uint64_t* countRow = neighbourCounts.Row(y);
+		uint64_t* zeroRow = zeroRuns.zeros.Row(y);
+		for (int i = 0; i < wordsPerRow; i++)
+		{
+			uint64_t zeroWord = 0;
+			for (int j = 0; j < 4 && i * 4 + j < countWordsPerRow; j++)
+			{
+				zeroWord |= GetZeroNibbles(countRow[i * 4 + j]) << (j * 16);
+			}
+			const uint64_t validMask = i == wordsPerRow - 1 ? mines.GetTailMask() : ~uint64_t(0);
+			zeroWord &= ~mines.Row(y)[i] & validMask;
+			zeroRow[i] = zeroWord;
+
+			for (uint64_t bits = zeroWord; bits != 0;)
+			{
+				const int start = BitGrid::CountTrailingZeros(bits);
+				const uint64_t gaps = ~bits & (~uint64_t(0) << start);
+				const int end = gaps != 0 ? BitGrid::CountTrailingZeros(gaps) : 64;
+				bits = end < 64 ? bits & (~uint64_t(0) << end) : 0u;
+				const int xStart = i * 64 + start;
+				const int xEnd = i * 64 + end - 1;
+				// runs crossing a word boundary arrive in two pieces
+				if (runs.size() > rowStarts.back() && runs.back().xEnd == xStart - 1)
+				{
+					runs.back().xEnd = xEnd;
+				}
+				else
+				{
+					runs.push_back({ y, xStart, xEnd });
+					parents.push_back(-1);
+				}
+			}
+		}
+
+		// 8-connected: runs touch when their x ranges come within one tile
+		if (y > 0)
+		{
+			size_t above = rowStarts[rowStarts.size() - 2];
+			const size_t aboveEnd = rowStarts.back();
+			for (size_t run = aboveEnd; run < runs.size(); run++)
+			{
+				while (above < aboveEnd && runs[above].xEnd < runs[run].xStart - 1)
+				{
+					above++;
+				}
+				for (size_t other = above; other < aboveEnd && runs[other].xStart <= runs[run].xEnd + 1; other++)
+				{
+					const int a = FindRoot(parents, int(run));
+					const int b = FindRoot(parents, int(other));
+					if (a != b)
+					{
+						// the earlier run stays the root, so openings are
+						// numbered by their first run below
+						parents[std::max(a, b)] = std::min(a, b);
+					}
+				}
+			}
+		}
+		rowStarts.push_back(runs.size());
+	}
+
+	zeroRuns.openings.assign(runs.size(), 0);
+	zeroRuns.nOpenings = 0;
+	for (size_t run = 0; run < runs.size(); run++)
+	{
+		const int root = FindRoot(parents, int(run));
+		zeroRuns.openings[run] = root == int(run) ? zeroRuns.nOpenings++ : zeroRuns.openings[root];
+	}
+}
+
+void OpeningIndex::Build(const BitGrid& mines, const NibbleGrid& neighbourCounts)
+{
+	const int width = mines.GetWidth();
+	const int height = mines.GetHeight();
+	ZeroRuns found(width, height);
+	FindZeroRuns(mines, neighbourCounts, found);
+
+	zeroRowStarts = found.rowStarts;
+	zeroRuns.clear();
+	zeroRuns.reserve(found.runs.size());
+	for (size_t run = 0; run < found.runs.size(); run++)
+	{
+		zeroRuns.push_back({ found.runs[run].xEnd, found.openings[run] });
+	}
+
+	// every tile around a zero is safe and part of the opening, so row y of
+	// an opening is covered by its zero runs in rows y-1..y+1, each one tile
+	// wider on both sides. Those three rows' runs are merged in x order and
+	// each extends its opening's last span when they overlap; spans of
+	// different openings may share border tiles.
+	std::vector<Span> rowSpans;
+	std::vector<int> rowSpanOpenings;
+	std::vector<size_t> lastSpans(found.nOpenings, ~size_t(0));
+	for (int y = 0; y < height; y++)
+	{
+		size_t cursors[3];
+		size_t ends[3];
+		for (int row = 0; row < 3; row++)
+		{
+			const int runRow = std::min(std::max(y - 1 + row, 0), height - 1);
+			const bool isInside = y - 1 + row >= 0 && y - 1 + row < height;
+			cursors[row] = found.rowStarts[runRow];
+			ends[row] = isInside ? found.rowStarts[runRow + 1] : cursors[row];
+		}
+		for (;;)
+		{
+			int next = -1;
+			for (int row = 0; row < 3; row++)
+			{
+				if (cursors[row] < ends[row] &&
+					(next < 0 || found.runs[cursors[row]].xStart < found.runs[cursors[next]].xStart))
+				{
+					next = row;
+				}
+			}
+			if (next < 0) break;
+			const size_t run = cursors[next]++;
+			const int opening = found.openings[run];
+			const int xStart = std::max(0, found.runs[run].xStart - 1);
+			const int xEnd = std::min(width - 1, found.runs[run].xEnd + 1);
+			const size_t last = lastSpans[opening];
+			if (last != ~size_t(0) && rowSpans[last].y == y && xStart <= rowSpans[last].xEnd + 1)
+			{
+				rowSpans[last].xEnd = std::max(rowSpans[last].xEnd, xEnd);
+			}
+			else
+			{
+				lastSpans[opening] = rowSpans.size();
+				rowSpans.push_back({ y, xStart, xEnd });
+				rowSpanOpenings.push_back(opening);
+			}
+		}
+	}
+
+	// then grouped by opening, keeping the row-major order within each
+	spanStarts.assign(size_t(found.nOpenings) + 1, 0);
+	for (int opening : rowSpanOpenings)
+	{
+		spanStarts[opening + 1]++;
+	}
+	for (int opening = 0; opening < found.nOpenings; opening++)
+	{
+		spanStarts[opening + 1] += spanStarts[opening];
+	}
+	spans.resize(rowSpans.size());
+	std::vector<size_t> cursors(spanStarts.begin(), spanStarts.end() - 1);
+	for (size_t i = 0; i < rowSpans.size(); i++)
+	{
+		spans[cursors[rowSpanOpenings[i]]++] = rowSpans[i];
+	}
+	spans.shrink_to_fit();
+	isBuilt = true;
+}
+
+bool OpeningIndex::IsBuilt() const
+{
+	return isBuilt;
+}
+
+int OpeningIndex::GetOpeningCount() const
+{
+	return int(spanStarts.size()) - 1;
+}
+
+int OpeningIndex::FindOpening(const Vei2& gridPos) const
+{
+	assert(isBuilt);
+	const auto rowEnd = zeroRuns.begin() + zeroRowStarts[gridPos.y + 1];
+	const auto run = std::lower_bound(zeroRuns.begin() + zeroRowStarts[gridPos.y], rowEnd, gridPos.x,
+		[](const ZeroRun& run, int x)
+	{
+		return run.xEnd < x;
+	});
+	assert(run != rowEnd);
+	return run->opening;
+}
+
+const OpeningIndex::Span* OpeningIndex::GetSpansBegin(int opening) const
+{
+	return spans.data() + spanStarts[opening];
+}
+
+const OpeningIndex::Span* OpeningIndex::GetSpansEnd(int opening) const
+{
+	return spans.data() + spanStarts[opening + 1];
+}
+
+size_t OpeningIndex::GetMemoryBytes() const
+{
+	return zeroRuns.capacity() * sizeof(ZeroRun) + zeroRowStarts.capacity() * sizeof(size_t) +
+		spans.capacity() * sizeof(Span) + spanStarts.capacity() * sizeof(size_t);
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "Vei2.h"
+#include "BitGrid.h"
+#include "NibbleGrid.h"
+#include <cstddef>
+#include <vector>
+
+// The openings of a generated board, computed once: each 8-connected region
+// of zero tiles together with its numbered border, stored as row spans in
+// one flat array with per-opening offsets. Clicking a zero can then reveal
+// its opening span by span instead of searching for it. Zero tiles are kept
+// as row runs tagged with their opening, so finding the opening of a tile
+// is a binary search within its row.
+class OpeningIndex
+{
+public:
+	// tiles xStart..xEnd (inclusive) of row y
+	struct Span
+	{
+		int y;
+		int xStart;
+		int xEnd;
+	};
+	// the zero tiles of a board: as a plane, as row-major runs (rowStarts[y]
+	// is the first run of row y) and the opening of each run, numbered
+	// 0..nOpenings-1 in order of their first run
+	struct ZeroRuns
+	{
+		ZeroRuns(int width, int height);
+		BitGrid zeros;
+		std::vector<Span> runs;
+		std::vector<size_t> rowStarts;
+		std::vector<int> openings;
+		int nOpenings = 0;
+	};
+public:
+	// one pass over the neighbour counts; runs are joined to the runs they
+	// touch in the row above with union-find
+	static void FindZeroRuns(const BitGrid& mines, const NibbleGrid& neighbourCounts, ZeroRuns& zeroRuns);
+	// empty until Build
+	OpeningIndex() = default;
+	void Build(const BitGrid& mines, const NibbleGrid& neighbourCounts);
+	bool IsBuilt() const;
+	int GetOpeningCount() const;
+	// opening of a zero tile
+	int FindOpening(const Vei2& gridPos) const;
+	// the opening's tiles and border as disjoint spans, row-major
+	const Span* GetSpansBegin(int opening) const;
+	const Span* GetSpansEnd(int opening) const;
+	size_t GetMemoryBytes() const;
+private:
+	// a zero run needs neither its row (given by zeroRowStarts) nor its
+	// start: the tile looked up is known to be a zero, so the first run of
+	// its row ending at or after it holds it
+	struct ZeroRun
+	{
+		int xEnd;
+		int opening;
+	};
+private:
+	bool isBuilt = false;
+	std::vector<ZeroRun> zeroRuns;
+	std::vector<size_t> zeroRowStarts;
+	std::vector<Span> spans;
+	std::vector<size_t> spanStarts;
+};
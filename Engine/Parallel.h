@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Calls body(i) for every i in [0, count) on up to nThreads threads
+// (0 = one per hardware thread). Indices are handed out one at a time, so
+// callers should make each index a reasonably large piece of work.
+template<typename Body>
+void ParallelFor(int count, int nThreads, Body&& body)
+{
+	if (nThreads <= 0)
+	{
+		nThreads = int(std::max(1u, std::thread::hardware_concurrency()));
+	}
+	nThreads = std::min(nThreads, count);
+	if (nThreads <= 1)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			body(i);
+		}
+		return;
+	}
+
+	std::atomic<int> next(0);
+	auto worker = [&]()
+	{
+		for (int i = next++; i < count; i = next++)
+		{
+			body(i);
+		}
+	};
+	std::vector<std::thread> threads;
+	threads.reserve(nThreads - 1);
+	for (int t = 1; t < nThreads; t++)
+	{
+		threads.emplace_back(worker);
+	}
+	worker();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+// Same contract as ParallelFor, for work whose cost varies a lot per index,
+// and body also gets the calling thread's index in [0, nThreads). Each thread
+// starts on its own contiguous slice and, once that is done, steals the back
+// half of another thread's remaining slice, so no shared counter is touched
+// per index and a few long items cannot leave the other threads idle.
+template<typename Body>
+void ParallelForStealing(int count, int nThreads, Body&& body)
+{
+	if (nThreads <= 0)
+	{
+		nThreads = int(std::max(1u, std::thread::hardware_concurrency()));
+	}
+	nThreads = std::max(1, std::min(nThreads, count));
+
+	// [begin, end) packed as begin | end << 32 so a slice changes atomically
+	auto pack = [](uint32_t begin, uint32_t end)
+	{
+		return uint64_t(begin) | uint64_t(end) << 32;
+	};
+	std::vector<std::atomic<uint64_t>> slices(nThreads);
+	for (int t = 0; t < nThreads; t++)
+	{
+		slices[t].store(pack(uint32_t(int64_t(count) * t / nThreads), uint32_t(int64_t(count) * (t + 1) / nThreads)));
+	}
+
+	auto worker = [&](int t)
+	{
+		for (;;)
+		{
+			uint64_t slice = slices[t].load();
+			while (uint32_t(slice) < uint32_t(slice >> 32))
+			{
+				const uint32_t index = uint32_t(slice);
+				if (slices[t].compare_exchange_weak(slice, pack(index + 1, uint32_t(slice >> 32))))
+				{
+					body(int(index), t);
+					slice = slices[t].load();
+				}
+			}
+
+			// own slice is empty, so no other thread can take from it while
+			// the stolen half is being stored
+			bool hasStolen = false;
+			for (int i = 1; i < nThreads && !hasStolen; i++)
+			{
+				std::atomic<uint64_t>& victim = slices[(t + i) % nThreads];
+				uint64_t other = victim.load();
+				while (uint32_t(other) < uint32_t(other >> 32))
+				{
+					const uint32_t begin = uint32_t(other);
+					const uint32_t end = uint32_t(other >> 32);
+					const uint32_t middle = begin + (end - begin) / 2;
+					if (victim.compare_exchange_weak(other, pack(begin, middle)))
+					{
+						slices[t].store(pack(middle, end));
+						hasStolen = true;
+						break;
+					}
+				}
+			}
+			if (!hasStolen) return;
+		}
+	};
+	std::vector<std::thread> threads;
+	threads.reserve(nThreads - 1);
+	for (int t = 1; t < nThreads; t++)
+	{
+		threads.emplace_back(worker, t);
+	}
+	worker(0);
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
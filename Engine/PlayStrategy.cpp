@@ -0,0 +1,138 @@
+#include "PlayStrategy.h"
+#include "MineProbability.h"
+#include <assert.h>
+
+std::unique_ptr<PlayStrategy> PlayStrategy::Create(const std::string& name)
+{
+	if (name == "random")
+	{
+		return std::unique_ptr<PlayStrategy>(new RandomStrategy());
+	}
+	if (name == "solver")
+	{
+		return std::unique_ptr<PlayStrategy>(new SolverStrategy());
+	}
+	if (name == "linear")
+	{
+		return std::unique_ptr<PlayStrategy>(new SolverStrategy(true));
+	}
+	return nullptr;
+}
+
+void RandomStrategy::Reset(const MineField& field)
+{
+	rng = CounterRng(field.GetSeed(), 1);
+	closedTiles.clear();
+	for (Vei2 pos = { 0, 0 }; pos.y < field.GetHeight(); pos.y++)
+	{
+		for (pos.x = 0; pos.x < field.GetWidth(); pos.x++)
+		{
+			closedTiles.push_back(pos);
+		}
+	}
+}
+
+PlayStrategy::Move RandomStrategy::NextMove(const MineField& field)
+{
+	// tiles opened since they were listed are dropped as they are drawn
+	for (;;)
+	{
+		assert(!closedTiles.empty());
+		const size_t i = size_t(rng.UniformBelow(closedTiles.size()));
+		const Vei2 pos = closedTiles[i];
+		closedTiles[i] = closedTiles.back();
+		closedTiles.pop_back();
+		if (field.TileAt(pos).IsHidden())
+		{
+			return { pos, false };
+		}
+	}
+}
+
+SolverStrategy::SolverStrategy(bool useLinearSolver)
+	:
+	useLinearSolver(useLinearSolver)
+{
+}
+
+void SolverStrategy::Reset(const MineField& field)
+{
+	solver.reset(new MineSolver(field));
+	if (useLinearSolver)
+	{
+		linearSolver.reset(new LinearSolver(field));
+	}
+	safeTiles.clear();
+	mineTiles.clear();
+}
+
+PlayStrategy::Move SolverStrategy::NextMove(const MineField& field)
+{
+	if (!field.IsGenerated())
+	{
+		return { { field.GetWidth() / 2, field.GetHeight() / 2 }, false };
+	}
+	solver->Update(field.GetLastChangedRuns());
+	for (const Vei2& pos : solver->TakeSafeTiles())
+	{
+		safeTiles.push_back(pos);
+	}
+	for (const Vei2& pos : solver->TakeMineTiles())
+	{
+		mineTiles.push_back(pos);
+	}
+	if (linearSolver)
+	{
+		// kept up to date every move so it never has to rebuild; its
+		// deductions are only needed once the local rules run dry
+		linearSolver->Update(field.GetLastChangedRuns());
+		if (safeTiles.empty() && mineTiles.empty())
+		{
+			safeTiles = linearSolver->TakeSafeTiles();
+			mineTiles = linearSolver->TakeMineTiles();
+		}
+	}
+
+	while (!mineTiles.empty())
+	{
+		const Vei2 pos = mineTiles.back();
+		mineTiles.pop_back();
+		if (field.TileAt(pos).IsHidden())
+		{
+			return { pos, true };
+		}
+	}
+	while (!safeTiles.empty())
+	{
+		const Vei2 pos = safeTiles.back();
+		safeTiles.pop_back();
+		if (field.TileAt(pos).IsHidden())
+		{
+			return { pos, false };
+		}
+	}
+	return Guess(field);
+}
+
+PlayStrategy::Move SolverStrategy::Guess(const MineField& field) const
+{
+	const MineProbability probability(field);
+	Vei2 bestPos = { -1, -1 };
+	double bestProbability = 2.0;
+	for (Vei2 pos = { 0, 0 }; pos.y < field.GetHeight(); pos.y++)
+	{
+		for (pos.x = 0; pos.x < field.GetWidth(); pos.x++)
+		{
+			if (!field.TileAt(pos).IsHidden() || solver->IsKnownMine(pos) ||
+				(linearSolver && linearSolver->IsKnownMine(pos))) continue;
+			const double mineProbability = probability.GetProbability(pos);
+			if (mineProbability < bestProbability)
+			{
+				bestProbability = mineProbability;
+				bestPos = pos;
+			}
+		}
+	}
+	assert(bestPos.x >= 0);
+	return { bestPos, false };
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include "Vei2.h"
+#include "CounterRng.h"
+#include "MineField.h"
+#include "MineSolver.h"
+#include "LinearSolver.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// A bot that plays a MineField through its public reveal/flag clicks. One
+// instance plays one game at a time: Reset before the first move, then
+// NextMove before every move, which the caller applies to the field. The
+// strategy reads MineField::GetLastChangedRuns() to follow the game.
+class PlayStrategy
+{
+public:
+	struct Move
+	{
+		Vei2 gridPos;
+		bool isFlag;
+	};
+public:
+	virtual ~PlayStrategy() = default;
+	virtual void Reset(const MineField& field) = 0;
+	virtual Move NextMove(const MineField& field) = 0;
+	// "random", "solver" or "linear"; nullptr for an unknown name
+	static std::unique_ptr<PlayStrategy> Create(const std::string& name);
+};
+
+// reveals a uniformly random closed tile every move
+class RandomStrategy : public PlayStrategy
+{
+public:
+	void Reset(const MineField& field) override;
+	Move NextMove(const MineField& field) override;
+private:
+	CounterRng rng = CounterRng(0, 0);
+	std::vector<Vei2> closedTiles;
+};
+
+// reveals every tile MineSolver proves safe and flags the proven mines; when
+// stuck, reveals the tile MineProbability gives the lowest mine probability.
+// With useLinearSolver, LinearSolver's deductions are tried before guessing.
+class SolverStrategy : public PlayStrategy
+{
+public:
+	SolverStrategy(bool useLinearSolver = false);
+	void Reset(const MineField& field) override;
+	Move NextMove(const MineField& field) override;
+private:
+	Move Guess(const MineField& field) const;
+private:
+	bool useLinearSolver;
+	std::unique_ptr<MineSolver> solver;
+	std::unique_ptr<LinearSolver> linearSolver;
+	std::vector<Vei2> safeTiles;
+	std::vector<Vei2> mineTiles;
+};
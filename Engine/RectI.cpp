@@ -1,4 +1,5 @@
 #include "RectI.h"
+#include <algorithm>
 
 RectI::RectI( int left_in,int right_in,int top_in,int bottom_in )
 	:
@@ -52,6 +53,12 @@ RectI RectI::GetExpanded( int offset ) const
 	return RectI( left - offset,right + offset,top - offset,bottom + offset );
 }
 
+RectI RectI::GetClippedTo( const RectI& clip ) const
+{
+	return RectI( std::max( left,clip.left ),std::min( right,clip.right ),
+		std::max( top,clip.top ),std::min( bottom,clip.bottom ) );
+}
+
 Vei2 RectI::GetCenter() const
 {
 	return Vei2( (left + right) / 2,(top + bottom) / 2 );
@@ -14,6 +14,7 @@ public:
 	bool Contains(const Vei2 point) const;
 	static RectI FromCenter( const Vei2& center,int halfWidth,int halfHeight );
 	RectI GetExpanded( int offset ) const;
+	RectI GetClippedTo( const RectI& clip ) const;
 	Vei2 GetCenter() const;
 public:
 	int left;
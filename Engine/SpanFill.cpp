@@ -0,0 +1,190 @@
+#include "SpanFill.h"
+#include <assert.h>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MINEFIELD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// SSE2 is part of x64, and of 32-bit builds made with /arch:SSE2 or -msse2
+#if defined(MINEFIELD_X86) && (defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MINEFIELD_SSE2 1
+#endif
+
+#if defined(MINEFIELD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define MINEFIELD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MINEFIELD_TARGET_AVX2
+#endif
+
+void SpanFill::Fill(Color* pixels, int count, Color c, Path path)
+{
+	assert(count >= 0);
+	// Color is a single dword, so a row of them is a row of dwords
+	GetFillFunction(Resolve(path))(reinterpret_cast<unsigned int*>(pixels), count, c.dword);
+}
+
+void SpanFill::FillRect(Color* pixels, int pitch, int x0, int y0, int x1, int y1, Color c, Path path)
+{
+	assert(x0 >= 0 && x0 <= x1 && x1 <= pitch);
+	assert(y0 <= y1);
+	// the path is picked once per rectangle rather than once per row
+	void (*const fill)(unsigned int*, int, unsigned int) = GetFillFunction(Resolve(path));
+	unsigned int* row = reinterpret_cast<unsigned int*>(pixels + size_t(pitch) * y0 + x0);
+	for (int y = y0; y < y1; y++, row += pitch)
+	{
+		fill(row, x1 - x0, c.dword);
+	}
+}
+
+void SpanFill::Clear(Color* pixels, size_t count, Color c)
+{
+	unsigned int* p = reinterpret_cast<unsigned int*>(pixels);
+#if defined(MINEFIELD_SSE2)
+	// scalar up to 16-byte alignment, which streaming stores need
+	for (; count > 0 && (reinterpret_cast<uintptr_t>(p) & 15) != 0; count--)
+	{
+		*p++ = c.dword;
+	}
+	const __m128i v = _mm_set1_epi32(int(c.dword));
+	for (; count >= 16; count -= 16, p += 16)
+	{
+		_mm_stream_si128(reinterpret_cast<__m128i*>(p), v);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(p + 4), v);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(p + 8), v);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(p + 12), v);
+	}
+	for (; count >= 4; count -= 4, p += 4)
+	{
+		_mm_stream_si128(reinterpret_cast<__m128i*>(p), v);
+	}
+	// streaming stores are weakly ordered; make them visible before anything
+	// else touches the buffer
+	_mm_sfence();
+#endif
+	for (; count > 0; count--)
+	{
+		*p++ = c.dword;
+	}
+}
+
+bool SpanFill::IsSse2Supported()
+{
+#if defined(MINEFIELD_SSE2)
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool SpanFill::IsAvx2Supported()
+{
+#if defined(MINEFIELD_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) return false;
+	__cpuid(info, 1);
+	const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+	__cpuidex(info, 7, 0);
+	return osSavesYmm && (info[1] & (1 << 5)) != 0;
+#elif defined(MINEFIELD_X86) && (defined(__GNUC__) || defined(__clang__))
+	return __builtin_cpu_supports("avx2") != 0;
+#else
+	return false;
+#endif
+}
+
+SpanFill::Path SpanFill::Resolve(Path path)
+{
+	if (path == Path::Auto)
+	{
+		// cpuid is too slow to run for every rectangle
+		static const Path best = IsAvx2Supported() ? Path::Avx2 : IsSse2Supported() ? Path::Sse2 : Path::Scalar;
+		return best;
+	}
+	assert(path != Path::Sse2 || IsSse2Supported());
+	assert(path != Path::Avx2 || IsAvx2Supported());
+	return path;
+}
+
+void (*SpanFill::GetFillFunction(Path path))(unsigned int*, int, unsigned int)
+{
+	switch (path)
+	{
+	case Path::Avx2:
+		return FillAvx2;
+	case Path::Sse2:
+		return FillSse2;
+	default:
+		return FillScalar;
+	}
+}
+
+void SpanFill::FillScalar(unsigned int* pixels, int count, unsigned int value)
+{
+	for (int i = 0; i < count; i++)
+	{
+		pixels[i] = value;
+	}
+}
+
+#if defined(MINEFIELD_SSE2)
+void SpanFill::FillSse2(unsigned int* pixels, int count, unsigned int value)
+{
+	// scalar head up to 16-byte alignment, aligned stores, scalar tail
+	int i = 0;
+	for (; i < count && (reinterpret_cast<uintptr_t>(pixels + i) & 15) != 0; i++)
+	{
+		pixels[i] = value;
+	}
+	const __m128i v = _mm_set1_epi32(int(value));
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm_store_si128(reinterpret_cast<__m128i*>(pixels + i), v);
+		_mm_store_si128(reinterpret_cast<__m128i*>(pixels + i + 4), v);
+	}
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_store_si128(reinterpret_cast<__m128i*>(pixels + i), v);
+	}
+	FillScalar(pixels + i, count - i, value);
+}
+#else
+void SpanFill::FillSse2(unsigned int* pixels, int count, unsigned int value)
+{
+	FillScalar(pixels, count, value);
+}
+#endif
+
+#if defined(MINEFIELD_X86)
+MINEFIELD_TARGET_AVX2
+void SpanFill::FillAvx2(unsigned int* pixels, int count, unsigned int value)
+{
+	int i = 0;
+	for (; i < count && (reinterpret_cast<uintptr_t>(pixels + i) & 31) != 0; i++)
+	{
+		pixels[i] = value;
+	}
+	const __m256i v = _mm256_set1_epi32(int(value));
+	for (; i + 16 <= count; i += 16)
+	{
+		_mm256_store_si256(reinterpret_cast<__m256i*>(pixels + i), v);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(pixels + i + 8), v);
+	}
+	for (; i + 8 <= count; i += 8)
+	{
+		_mm256_store_si256(reinterpret_cast<__m256i*>(pixels + i), v);
+	}
+	FillScalar(pixels + i, count - i, value);
+}
+#else
+void SpanFill::FillAvx2(unsigned int* pixels, int count, unsigned int value)
+{
+	FillScalar(pixels, count, value);
+}
+#endif
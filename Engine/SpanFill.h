@@ -0,0 +1,35 @@
+#pragma once
+#include "Colors.h"
+#include <cstddef>
+
+// Fills runs of 32-bit pixels for Graphics: rectangle rows with aligned
+// SSE2 / AVX2 stores, and whole-frame clears with non-temporal (streaming)
+// stores, which write around the cache since a cleared frame is not read
+// back before it is drawn over. The scalar path is the fallback off x86.
+class SpanFill
+{
+public:
+	enum class Path
+	{
+		Auto,
+		Scalar,
+		Sse2,
+		Avx2
+	};
+public:
+	static void Fill(Color* pixels, int count, Color c, Path path = Path::Auto);
+	// rows y0..y1-1, columns x0..x1-1 of an image with the given pitch in
+	// pixels; the rectangle must already be clipped to the image
+	static void FillRect(Color* pixels, int pitch, int x0, int y0, int x1, int y1, Color c, Path path = Path::Auto);
+	// for big buffers only: streaming stores skip the cache, which is slower
+	// than Fill for anything that fits in it
+	static void Clear(Color* pixels, size_t count, Color c);
+	static bool IsSse2Supported();
+	static bool IsAvx2Supported();
+private:
+	static Path Resolve(Path path);
+	static void (*GetFillFunction(Path path))(unsigned int* pixels, int count, unsigned int value);
+	static void FillScalar(unsigned int* pixels, int count, unsigned int value);
+	static void FillSse2(unsigned int* pixels, int count, unsigned int value);
+	static void FillAvx2(unsigned int* pixels, int count, unsigned int value);
+};
@@ -0,0 +1,1885 @@
+#include "SpriteAtlas.h"
+
+// Generated by Tools/make_sprite_atlas.py; do not edit.
+
+const SpriteAtlas::Sprite SpriteAtlas::sprites[Count] =
+{
+	{ 0,0,0,16 },	// Tile0
+	{ 0,0,16,16 },	// Tile1
+	{ 0,0,32,16 },	// Tile2
+	{ 0,0,48,16 },	// Tile3
+	{ 0,0,64,16 },	// Tile4
+	{ 0,0,80,16 },	// Tile5
+	{ 0,0,96,16 },	// Tile6
+	{ 0,0,112,16 },	// Tile7
+	{ 0,0,128,16 },	// Tile8
+	{ 0,0,144,16 },	// Button
+	{ 0,0,160,22 },	// Cross
+	{ 0,0,182,10 },	// Flag
+	{ 0,0,192,16 },	// Bomb
+	{ 0,0,208,16 },	// BombRed
+	{ 127,96,224,830 },	// Win
+	{ 90,20,1054,493 },	// Small
+	{ 112,20,1547,716 },	// Medium
+	{ 87,20,2263,467 },	// Large
+};
+
+const SpriteAtlas::Span SpriteAtlas::spans[2730] =
+{
+	{ 0,0,16,0 }, { 0,1,16,16 }, { 0,2,16,32 }, { 0,3,16,48 }, { 0,4,16,64 }, { 0,5,16,80 }, { 0,6,16,96 }, { 0,7,16,112 },
+	{ 0,8,16,128 }, { 0,9,16,144 }, { 0,10,16,160 }, { 0,11,16,176 }, { 0,12,16,192 }, { 0,13,16,208 }, { 0,14,16,224 }, { 0,15,16,240 },
+	{ 0,0,16,256 }, { 0,1,16,272 }, { 0,2,16,288 }, { 0,3,16,304 }, { 0,4,16,320 }, { 0,5,16,336 }, { 0,6,16,352 }, { 0,7,16,368 },
+	{ 0,8,16,384 }, { 0,9,16,400 }, { 0,10,16,416 }, { 0,11,16,432 }, { 0,12,16,448 }, { 0,13,16,464 }, { 0,14,16,480 }, { 0,15,16,496 },
+	{ 0,0,16,512 }, { 0,1,16,528 }, { 0,2,16,544 }, { 0,3,16,560 }, { 0,4,16,576 }, { 0,5,16,592 }, { 0,6,16,608 }, { 0,7,16,624 },
+	{ 0,8,16,640 }, { 0,9,16,656 }, { 0,10,16,672 }, { 0,11,16,688 }, { 0,12,16,704 }, { 0,13,16,720 }, { 0,14,16,736 }, { 0,15,16,752 },
+	{ 0,0,16,768 }, { 0,1,16,784 }, { 0,2,16,800 }, { 0,3,16,816 }, { 0,4,16,832 }, { 0,5,16,848 }, { 0,6,16,864 }, { 0,7,16,880 },
+	{ 0,8,16,896 }, { 0,9,16,912 }, { 0,10,16,928 }, { 0,11,16,944 }, { 0,12,16,960 }, { 0,13,16,976 }, { 0,14,16,992 }, { 0,15,16,1008 },
+	{ 0,0,16,1024 }, { 0,1,16,1040 }, { 0,2,16,1056 }, { 0,3,16,1072 }, { 0,4,16,1088 }, { 0,5,16,1104 }, { 0,6,16,1120 }, { 0,7,16,1136 },
+	{ 0,8,16,1152 }, { 0,9,16,1168 }, { 0,10,16,1184 }, { 0,11,16,1200 }, { 0,12,16,1216 }, { 0,13,16,1232 }, { 0,14,16,1248 }, { 0,15,16,1264 },
+	{ 0,0,16,1280 }, { 0,1,16,1296 }, { 0,2,16,1312 }, { 0,3,16,1328 }, { 0,4,16,1344 }, { 0,5,16,1360 }, { 0,6,16,1376 }, { 0,7,16,1392 },
+	{ 0,8,16,1408 }, { 0,9,16,1424 }, { 0,10,16,1440 }, { 0,11,16,1456 }, { 0,12,16,1472 }, { 0,13,16,1488 }, { 0,14,16,1504 }, { 0,15,16,1520 },
+	{ 0,0,16,1536 }, { 0,1,16,1552 }, { 0,2,16,1568 }, { 0,3,16,1584 }, { 0,4,16,1600 }, { 0,5,16,1616 }, { 0,6,16,1632 }, { 0,7,16,1648 },
+	{ 0,8,16,1664 }, { 0,9,16,1680 }, { 0,10,16,1696 }, { 0,11,16,1712 }, { 0,12,16,1728 }, { 0,13,16,1744 }, { 0,14,16,1760 }, { 0,15,16,1776 },
+	{ 0,0,16,1792 }, { 0,1,16,1808 }, { 0,2,16,1824 }, { 0,3,16,1840 }, { 0,4,16,1856 }, { 0,5,16,1872 }, { 0,6,16,1888 }, { 0,7,16,1904 },
+	{ 0,8,16,1920 }, { 0,9,16,1936 }, { 0,10,16,1952 }, { 0,11,16,1968 }, { 0,12,16,1984 }, { 0,13,16,2000 }, { 0,14,16,2016 }, { 0,15,16,2032 },
+	{ 0,0,16,2048 }, { 0,1,16,2064 }, { 0,2,16,2080 }, { 0,3,16,2096 }, { 0,4,16,2112 }, { 0,5,16,2128 }, { 0,6,16,2144 }, { 0,7,16,2160 },
+	{ 0,8,16,2176 }, { 0,9,16,2192 }, { 0,10,16,2208 }, { 0,11,16,2224 }, { 0,12,16,2240 }, { 0,13,16,2256 }, { 0,14,16,2272 }, { 0,15,16,2288 },
+	{ 0,0,16,2304 }, { 0,1,16,2320 }, { 0,2,16,2336 }, { 0,3,16,2352 }, { 0,4,16,2368 }, { 0,5,16,2384 }, { 0,6,16,2400 }, { 0,7,16,2416 },
+	{ 0,8,16,2432 }, { 0,9,16,2448 }, { 0,10,16,2464 }, { 0,11,16,2480 }, { 0,12,16,2496 }, { 0,13,16,2512 }, { 0,14,16,2528 }, { 0,15,16,2544 },
+	{ 2,2,2,2560 }, { 13,2,2,2562 }, { 3,3,2,2564 }, { 12,3,2,2566 }, { 4,4,2,2568 }, { 11,4,2,2570 }, { 5,5,2,2572 }, { 10,5,2,2574 },
+	{ 6,6,2,2576 }, { 9,6,2,2578 }, { 7,7,3,2580 }, { 7,8,3,2583 }, { 6,9,2,2586 }, { 9,9,2,2588 }, { 5,10,2,2590 }, { 10,10,2,2592 },
+	{ 4,11,2,2594 }, { 11,11,2,2596 }, { 3,12,2,2598 }, { 12,12,2,2600 }, { 2,13,2,2602 }, { 13,13,2,2604 }, { 7,3,2,2606 }, { 5,4,4,2608 },
+	{ 4,5,5,2612 }, { 5,6,4,2617 }, { 7,7,2,2621 }, { 8,8,1,2623 }, { 8,9,1,2624 }, { 6,10,4,2625 }, { 4,11,8,2629 }, { 4,12,8,2637 },
+	{ 0,0,16,2645 }, { 0,1,16,2661 }, { 0,2,16,2677 }, { 0,3,16,2693 }, { 0,4,16,2709 }, { 0,5,16,2725 }, { 0,6,16,2741 }, { 0,7,16,2757 },
+	{ 0,8,16,2773 }, { 0,9,16,2789 }, { 0,10,16,2805 }, { 0,11,16,2821 }, { 0,12,16,2837 }, { 0,13,16,2853 }, { 0,14,16,2869 }, { 0,15,16,2885 },
+	{ 0,0,16,2901 }, { 0,1,16,2917 }, { 0,2,16,2933 }, { 0,3,16,2949 }, { 0,4,16,2965 }, { 0,5,16,2981 }, { 0,6,16,2997 }, { 0,7,16,3013 },
+	{ 0,8,16,3029 }, { 0,9,16,3045 }, { 0,10,16,3061 }, { 0,11,16,3077 }, { 0,12,16,3093 }, { 0,13,16,3109 }, { 0,14,16,3125 }, { 0,15,16,3141 },
+	{ 9,6,10,3157 }, { 27,6,10,3167 }, { 43,6,4,3177 }, { 53,6,4,3181 }, { 63,6,10,3185 }, { 79,6,12,3195 }, { 99,6,10,3207 }, { 115,6,12,3217 },
+	{ 131,6,4,3229 }, { 141,6,4,3233 }, { 150,6,12,3237 }, { 170,6,10,3249 }, { 186,6,12,3259 }, { 202,6,8,3271 }, { 216,6,10,3279 }, { 232,6,4,3289 },
+	{ 242,6,4,3293 }, { 9,7,10,3297 }, { 27,7,10,3307 }, { 43,7,4,3317 }, { 53,7,4,3321 }, { 63,7,10,3325 }, { 79,7,12,3335 }, { 99,7,10,3347 },
+	{ 115,7,12,3357 }, { 131,7,4,3369 }, { 141,7,4,3373 }, { 150,7,12,3377 }, { 170,7,10,3389 }, { 186,7,12,3399 }, { 202,7,8,3411 }, { 216,7,10,3419 },
+	{ 232,7,4,3429 }, { 242,7,4,3433 }, { 7,8,14,3437 }, { 25,8,14,3451 }, { 43,8,6,3465 }, { 53,8,6,3471 }, { 61,8,14,3477 }, { 79,8,14,3491 },
+	{ 97,8,14,3505 }, { 117,8,12,3519 }, { 131,8,6,3531 }, { 141,8,6,3537 }, { 150,8,14,3543 }, { 168,8,14,3557 }, { 188,8,12,3571 }, { 204,8,8,3583 },
+	{ 214,8,14,3591 }, { 232,8,6,3605 }, { 242,8,6,3611 }, { 7,9,14,3617 }, { 25,9,14,3631 }, { 43,9,6,3645 }, { 53,9,6,3651 }, { 61,9,14,3657 },
+	{ 79,9,14,3671 }, { 97,9,14,3685 }, { 117,9,12,3699 }, { 131,9,6,3711 }, { 141,9,6,3717 }, { 150,9,14,3723 }, { 168,9,14,3737 }, { 188,9,12,3751 },
+	{ 204,9,8,3763 }, { 214,9,14,3771 }, { 232,9,6,3785 }, { 242,9,6,3791 }, { 7,10,6,3797 }, { 19,10,4,3803 }, { 25,10,6,3807 }, { 35,10,6,3813 },
+	{ 43,10,8,3819 }, { 53,10,6,3827 }, { 61,10,6,3833 }, { 73,10,4,3839 }, { 79,10,6,3843 }, { 89,10,6,3849 }, { 97,10,6,3855 }, { 107,10,6,3861 },
+	{ 119,10,6,3867 }, { 131,10,6,3873 }, { 141,10,6,3879 }, { 150,10,6,3885 }, { 160,10,6,3891 }, { 168,10,6,3897 }, { 178,10,6,3903 }, { 190,10,6,3909 },
+	{ 204,10,6,3915 }, { 214,10,6,3921 }, { 224,10,6,3927 }, { 232,10,8,3933 }, { 242,10,6,3941 }, { 7,11,6,3947 }, { 19,11,4,3953 }, { 25,11,6,3957 },
+	{ 35,11,6,3963 }, { 43,11,8,3969 }, { 53,11,6,3977 }, { 61,11,6,3983 }, { 73,11,4,3989 }, { 79,11,6,3993 }, { 89,11,6,3999 }, { 97,11,6,4005 },
+	{ 107,11,6,4011 }, { 119,11,6,4017 }, { 131,11,6,4023 }, { 141,11,6,4029 }, { 150,11,6,4035 }, { 160,11,6,4041 }, { 168,11,6,4047 }, { 178,11,6,4053 },
+	{ 190,11,6,4059 }, { 204,11,6,4065 }, { 214,11,6,4071 }, { 224,11,6,4077 }, { 232,11,8,4083 }, { 242,11,6,4091 }, { 7,12,6,4097 }, { 25,12,6,4103 },
+	{ 35,12,6,4109 }, { 43,12,16,4115 }, { 61,12,14,4131 }, { 79,12,16,4145 }, { 97,12,16,4161 }, { 119,12,6,4177 }, { 131,12,6,4183 }, { 141,12,6,4189 },
+	{ 150,12,16,4195 }, { 168,12,16,4211 }, { 190,12,6,4227 }, { 204,12,6,4233 }, { 214,12,6,4239 }, { 224,12,6,4245 }, { 232,12,16,4251 }, { 7,13,6,4267 },
+	{ 25,13,6,4273 }, { 35,13,6,4279 }, { 43,13,16,4285 }, { 61,13,14,4301 }, { 79,13,16,4315 }, { 97,13,16,4331 }, { 119,13,6,4347 }, { 131,13,6,4353 },
+	{ 141,13,6,4359 }, { 150,13,16,4365 }, { 168,13,16,4381 }, { 190,13,6,4397 }, { 204,13,6,4403 }, { 214,13,6,4409 }, { 224,13,6,4415 }, { 232,13,16,4421 },
+	{ 7,14,6,4437 }, { 25,14,6,4443 }, { 35,14,6,4449 }, { 43,14,6,4455 }, { 51,14,8,4461 }, { 61,14,16,4469 }, { 79,14,14,4485 }, { 97,14,16,4499 },
+	{ 119,14,6,4515 }, { 131,14,6,4521 }, { 141,14,6,4527 }, { 150,14,14,4533 }, { 168,14,16,4547 }, { 190,14,6,4563 }, { 204,14,6,4569 }, { 214,14,6,4575 },
+	{ 224,14,6,4581 }, { 232,14,6,4587 }, { 240,14,8,4593 }, { 7,15,6,4601 }, { 25,15,6,4607 }, { 35,15,6,4613 }, { 43,15,6,4619 }, { 51,15,8,4625 },
+	{ 61,15,16,4633 }, { 79,15,14,4649 }, { 97,15,16,4663 }, { 119,15,6,4679 }, { 131,15,6,4685 }, { 141,15,6,4691 }, { 150,15,14,4697 }, { 168,15,16,4711 },
+	{ 190,15,6,4727 }, { 204,15,6,4733 }, { 214,15,6,4739 }, { 224,15,6,4745 }, { 232,15,6,4751 }, { 240,15,8,4757 }, { 7,16,6,4765 }, { 17,16,4,4771 },
+	{ 25,16,6,4775 }, { 35,16,6,4781 }, { 43,16,6,4787 }, { 53,16,6,4793 }, { 61,16,6,4799 }, { 71,16,6,4805 }, { 79,16,6,4811 }, { 89,16,6,4817 },
+	{ 97,16,6,4823 }, { 107,16,6,4829 }, { 119,16,6,4835 }, { 131,16,6,4841 }, { 141,16,6,4847 }, { 150,16,6,4853 }, { 160,16,6,4859 }, { 168,16,6,4865 },
+	{ 178,16,6,4871 }, { 190,16,6,4877 }, { 204,16,6,4883 }, { 214,16,6,4889 }, { 224,16,6,4895 }, { 232,16,6,4901 }, { 242,16,6,4907 }, { 7,17,6,4913 },
+	{ 17,17,4,4919 }, { 25,17,6,4923 }, { 35,17,6,4929 }, { 43,17,6,4935 }, { 53,17,6,4941 }, { 61,17,6,4947 }, { 71,17,6,4953 }, { 79,17,6,4959 },
+	{ 89,17,6,4965 }, { 97,17,6,4971 }, { 107,17,6,4977 }, { 119,17,6,4983 }, { 131,17,6,4989 }, { 141,17,6,4995 }, { 150,17,6,5001 }, { 160,17,6,5007 },
+	{ 168,17,6,5013 }, { 178,17,6,5019 }, { 190,17,6,5025 }, { 204,17,6,5031 }, { 214,17,6,5037 }, { 224,17,6,5043 }, { 232,17,6,5049 }, { 242,17,6,5055 },
+	{ 9,18,14,5061 }, { 27,18,14,5075 }, { 43,18,6,5089 }, { 53,18,6,5095 }, { 63,18,14,5101 }, { 79,18,6,5115 }, { 89,18,6,5121 }, { 97,18,6,5127 },
+	{ 107,18,6,5133 }, { 119,18,6,5139 }, { 133,18,14,5145 }, { 150,18,6,5159 }, { 160,18,6,5165 }, { 168,18,6,5171 }, { 178,18,6,5177 }, { 190,18,6,5183 },
+	{ 202,18,8,5189 }, { 216,18,14,5197 }, { 232,18,6,5211 }, { 242,18,6,5217 }, { 9,19,14,5223 }, { 27,19,14,5237 }, { 43,19,6,5251 }, { 53,19,6,5257 },
+	{ 63,19,14,5263 }, { 79,19,6,5277 }, { 89,19,6,5283 }, { 97,19,6,5289 }, { 107,19,6,5295 }, { 119,19,6,5301 }, { 133,19,14,5307 }, { 150,19,6,5321 },
+	{ 160,19,6,5327 }, { 168,19,6,5333 }, { 178,19,6,5339 }, { 190,19,6,5345 }, { 202,19,8,5351 }, { 216,19,14,5359 }, { 232,19,6,5373 }, { 242,19,6,5379 },
+	{ 11,20,10,5385 }, { 29,20,10,5395 }, { 45,20,4,5405 }, { 55,20,4,5409 }, { 65,20,10,5413 }, { 81,20,4,5423 }, { 91,20,4,5427 }, { 99,20,4,5431 },
+	{ 109,20,4,5435 }, { 121,20,4,5439 }, { 135,20,10,5443 }, { 152,20,4,5453 }, { 162,20,4,5457 }, { 170,20,4,5461 }, { 180,20,4,5465 }, { 192,20,4,5469 },
+	{ 204,20,8,5473 }, { 218,20,10,5481 }, { 234,20,4,5491 }, { 244,20,4,5495 }, { 11,21,10,5499 }, { 29,21,10,5509 }, { 45,21,4,5519 }, { 55,21,4,5523 },
+	{ 65,21,10,5527 }, { 81,21,4,5537 }, { 91,21,4,5541 }, { 99,21,4,5545 }, { 109,21,4,5549 }, { 121,21,4,5553 }, { 135,21,10,5557 }, { 152,21,4,5567 },
+	{ 162,21,4,5571 }, { 170,21,4,5575 }, { 180,21,4,5579 }, { 192,21,4,5583 }, { 204,21,8,5587 }, { 218,21,10,5595 }, { 234,21,4,5605 }, { 244,21,4,5609 },
+	{ 102,31,35,5613 }, { 102,32,36,5648 }, { 103,33,36,5684 }, { 103,34,37,5720 }, { 103,35,38,5757 }, { 103,36,39,5795 }, { 103,37,40,5834 }, { 103,38,41,5874 },
+	{ 103,39,41,5915 }, { 102,40,42,5956 }, { 102,41,42,5998 }, { 103,42,41,6040 }, { 103,43,41,6081 }, { 103,44,41,6122 }, { 103,45,41,6163 }, { 103,46,7,6204 },
+	{ 123,46,8,6211 }, { 103,47,41,6219 }, { 103,48,41,6260 }, { 102,49,42,6301 }, { 102,50,42,6343 }, { 103,51,41,6385 }, { 103,52,41,6426 }, { 103,53,41,6467 },
+	{ 103,54,41,6508 }, { 103,55,7,6549 }, { 125,55,4,6556 }, { 103,56,41,6560 }, { 102,57,42,6601 }, { 102,58,42,6643 }, { 103,59,41,6685 }, { 104,60,40,6726 },
+	{ 105,61,39,6766 }, { 106,62,38,6805 }, { 107,63,38,6843 }, { 108,64,37,6881 }, { 113,65,8,6918 }, { 123,65,6,6926 }, { 131,65,2,6932 }, { 139,65,8,6934 },
+	{ 113,66,8,6942 }, { 123,66,6,6950 }, { 131,66,2,6956 }, { 139,66,8,6958 }, { 111,67,10,6966 }, { 123,67,6,6976 }, { 131,67,4,6982 }, { 139,67,8,6986 },
+	{ 111,68,10,6994 }, { 123,68,6,7004 }, { 131,68,4,7010 }, { 139,68,8,7014 }, { 111,69,12,7022 }, { 125,69,4,7034 }, { 131,69,6,7038 }, { 139,69,8,7044 },
+	{ 111,70,12,7052 }, { 125,70,4,7064 }, { 131,70,6,7068 }, { 139,70,8,7074 }, { 111,71,12,7082 }, { 125,71,2,7094 }, { 129,71,18,7096 }, { 111,72,12,7114 },
+	{ 125,72,2,7126 }, { 129,72,18,7128 }, { 111,73,14,7146 }, { 127,73,20,7160 }, { 111,74,14,7180 }, { 127,74,20,7194 }, { 109,75,6,7214 }, { 117,75,8,7220 },
+	{ 127,75,8,7228 }, { 137,75,8,7236 }, { 109,76,6,7244 }, { 117,76,8,7250 }, { 127,76,8,7258 }, { 137,76,8,7266 }, { 107,77,10,7274 }, { 123,77,12,7284 },
+	{ 137,77,8,7296 }, { 107,78,10,7304 }, { 123,78,12,7314 }, { 137,78,8,7326 }, { 107,79,14,7334 }, { 123,79,12,7348 }, { 137,79,8,7360 }, { 107,80,14,7368 },
+	{ 123,80,12,7382 }, { 137,80,8,7394 }, { 107,81,14,7402 }, { 123,81,12,7416 }, { 137,81,8,7428 }, { 107,82,14,7436 }, { 123,82,12,7450 }, { 137,82,8,7462 },
+	{ 107,83,14,7470 }, { 123,83,12,7484 }, { 137,83,8,7496 }, { 107,84,14,7504 }, { 123,84,12,7518 }, { 137,84,8,7530 }, { 107,85,14,7538 }, { 123,85,10,7552 },
+	{ 137,85,8,7562 }, { 107,86,14,7570 }, { 123,86,10,7584 }, { 137,86,8,7594 }, { 113,87,8,7602 }, { 123,87,10,7610 }, { 139,87,4,7620 }, { 113,88,8,7624 },
+	{ 123,88,10,7632 }, { 139,88,4,7642 }, { 111,91,16,7646 }, { 129,91,6,7662 }, { 111,92,16,7668 }, { 129,92,6,7684 }, { 111,93,14,7690 }, { 127,93,2,7704 },
+	{ 131,93,4,7706 }, { 111,94,14,7710 }, { 127,94,2,7724 }, { 131,94,4,7726 }, { 109,95,6,7730 }, { 119,95,4,7736 }, { 125,95,4,7740 }, { 131,95,6,7744 },
+	{ 109,96,6,7750 }, { 119,96,4,7756 }, { 125,96,4,7760 }, { 131,96,6,7764 }, { 109,97,4,7770 }, { 115,97,2,7774 }, { 119,97,4,7776 }, { 125,97,4,7780 },
+	{ 131,97,6,7784 }, { 109,98,4,7790 }, { 115,98,2,7794 }, { 119,98,4,7796 }, { 125,98,4,7800 }, { 131,98,6,7804 }, { 109,99,2,7810 }, { 113,99,2,7812 },
+	{ 117,99,6,7814 }, { 125,99,4,7820 }, { 131,99,4,7824 }, { 109,100,2,7828 }, { 113,100,2,7830 }, { 117,100,6,7832 }, { 125,100,4,7838 }, { 131,100,4,7842 },
+	{ 107,101,4,7846 }, { 113,101,2,7850 }, { 117,101,12,7852 }, { 135,101,4,7864 }, { 107,102,4,7868 }, { 113,102,2,7872 }, { 117,102,12,7874 }, { 135,102,4,7886 },
+	{ 113,103,2,7890 }, { 129,103,10,7892 }, { 113,104,2,7902 }, { 129,104,10,7904 }, { 109,105,16,7914 }, { 127,105,14,7930 }, { 109,106,16,7944 }, { 127,106,14,7960 },
+	{ 109,107,16,7974 }, { 127,107,14,7990 }, { 109,108,16,8004 }, { 127,108,14,8020 }, { 109,109,14,8034 }, { 129,109,14,8048 }, { 109,110,14,8062 }, { 129,110,14,8076 },
+	{ 107,111,14,8090 }, { 129,111,14,8104 }, { 107,112,14,8118 }, { 129,112,14,8132 }, { 107,113,14,8146 }, { 131,113,12,8160 }, { 107,114,14,8172 }, { 131,114,12,8186 },
+	{ 105,115,14,8198 }, { 133,115,10,8212 }, { 105,116,14,8222 }, { 133,116,10,8236 }, { 103,117,14,8246 }, { 133,117,12,8260 }, { 103,118,14,8272 }, { 133,118,12,8286 },
+	{ 103,119,12,8298 }, { 133,119,12,8310 }, { 103,120,12,8322 }, { 133,120,12,8334 }, { 103,121,10,8346 }, { 135,121,10,8356 }, { 103,122,10,8366 }, { 135,122,10,8376 },
+	{ 103,123,10,8386 }, { 135,123,10,8396 }, { 103,124,10,8406 }, { 135,124,10,8416 }, { 99,125,12,8426 }, { 135,125,10,8438 }, { 99,126,12,8448 }, { 135,126,10,8460 },
+	{ 99,127,12,8470 }, { 135,127,10,8482 }, { 99,128,12,8492 }, { 135,128,10,8504 }, { 99,129,10,8514 }, { 135,129,10,8524 }, { 99,130,10,8534 }, { 135,130,10,8544 },
+	{ 101,131,8,8554 }, { 135,131,8,8562 }, { 101,132,8,8570 }, { 135,132,8,8578 }, { 101,133,6,8586 }, { 135,133,10,8592 }, { 101,134,6,8602 }, { 135,134,10,8608 },
+	{ 103,135,6,8618 }, { 135,135,12,8624 }, { 103,136,6,8636 }, { 135,136,12,8642 }, { 57,147,10,8654 }, { 91,147,4,8664 }, { 101,147,4,8668 }, { 109,147,8,8672 },
+	{ 121,147,4,8680 }, { 131,147,4,8684 }, { 139,147,12,8688 }, { 159,147,10,8700 }, { 175,147,12,8710 }, { 57,148,10,8722 }, { 91,148,4,8732 }, { 101,148,4,8736 },
+	{ 109,148,8,8740 }, { 121,148,4,8748 }, { 131,148,4,8752 }, { 139,148,12,8756 }, { 159,148,10,8768 }, { 175,148,12,8778 }, { 55,149,14,8790 }, { 91,149,6,8804 },
+	{ 101,149,6,8810 }, { 111,149,8,8816 }, { 121,149,6,8824 }, { 131,149,6,8830 }, { 139,149,14,8836 }, { 157,149,14,8850 }, { 175,149,14,8864 }, { 55,150,14,8878 },
+	{ 91,150,6,8892 }, { 101,150,6,8898 }, { 111,150,8,8904 }, { 121,150,6,8912 }, { 131,150,6,8918 }, { 139,150,14,8924 }, { 157,150,14,8938 }, { 175,150,14,8952 },
+	{ 55,151,6,8966 }, { 65,151,6,8972 }, { 91,151,6,8978 }, { 101,151,6,8984 }, { 111,151,6,8990 }, { 121,151,8,8996 }, { 131,151,6,9004 }, { 139,151,6,9010 },
+	{ 149,151,6,9016 }, { 157,151,6,9022 }, { 167,151,6,9028 }, { 175,151,6,9034 }, { 185,151,6,9040 }, { 55,152,6,9046 }, { 65,152,6,9052 }, { 91,152,6,9058 },
+	{ 101,152,6,9064 }, { 111,152,6,9070 }, { 121,152,8,9076 }, { 131,152,6,9084 }, { 139,152,6,9090 }, { 149,152,6,9096 }, { 157,152,6,9102 }, { 167,152,6,9108 },
+	{ 175,152,6,9114 }, { 185,152,6,9120 }, { 55,153,16,9126 }, { 91,153,8,9142 }, { 101,153,6,9150 }, { 111,153,6,9156 }, { 121,153,16,9162 }, { 139,153,16,9178 },
+	{ 157,153,16,9194 }, { 175,153,16,9210 }, { 55,154,16,9226 }, { 91,154,8,9242 }, { 101,154,6,9250 }, { 111,154,6,9256 }, { 121,154,16,9262 }, { 139,154,16,9278 },
+	{ 157,154,16,9294 }, { 175,154,16,9310 }, { 55,155,16,9326 }, { 91,155,16,9342 }, { 111,155,6,9358 }, { 121,155,6,9364 }, { 129,155,8,9370 }, { 139,155,14,9378 },
+	{ 157,155,16,9392 }, { 175,155,14,9408 }, { 55,156,16,9422 }, { 91,156,16,9438 }, { 111,156,6,9454 }, { 121,156,6,9460 }, { 129,156,8,9466 }, { 139,156,14,9474 },
+	{ 157,156,16,9488 }, { 175,156,14,9504 }, { 55,157,6,9518 }, { 65,157,6,9524 }, { 91,157,16,9530 }, { 111,157,6,9546 }, { 121,157,6,9552 }, { 131,157,6,9558 },
+	{ 139,157,6,9564 }, { 149,157,6,9570 }, { 157,157,6,9576 }, { 167,157,6,9582 }, { 175,157,6,9588 }, { 185,157,6,9594 }, { 55,158,6,9600 }, { 65,158,6,9606 },
+	{ 91,158,16,9612 }, { 111,158,6,9628 }, { 121,158,6,9634 }, { 131,158,6,9640 }, { 139,158,6,9646 }, { 149,158,6,9652 }, { 157,158,6,9658 }, { 167,158,6,9664 },
+	{ 175,158,6,9670 }, { 185,158,6,9676 }, { 55,159,6,9682 }, { 65,159,6,9688 }, { 91,159,8,9694 }, { 101,159,6,9702 }, { 109,159,8,9708 }, { 121,159,6,9716 },
+	{ 131,159,6,9722 }, { 139,159,6,9728 }, { 149,159,6,9734 }, { 157,159,6,9740 }, { 167,159,6,9746 }, { 175,159,6,9752 }, { 185,159,6,9758 }, { 55,160,6,9764 },
+	{ 65,160,6,9770 }, { 91,160,8,9776 }, { 101,160,6,9784 }, { 109,160,8,9790 }, { 121,160,6,9798 }, { 131,160,6,9804 }, { 139,160,6,9810 }, { 149,160,6,9816 },
+	{ 157,160,6,9822 }, { 167,160,6,9828 }, { 175,160,6,9834 }, { 185,160,6,9840 }, { 57,161,4,9846 }, { 67,161,4,9850 }, { 93,161,4,9854 }, { 103,161,4,9858 },
+	{ 111,161,8,9862 }, { 123,161,4,9870 }, { 133,161,4,9874 }, { 141,161,4,9878 }, { 151,161,4,9882 }, { 159,161,4,9886 }, { 169,161,4,9890 }, { 177,161,4,9894 },
+	{ 187,161,4,9898 }, { 57,162,4,9902 }, { 67,162,4,9906 }, { 93,162,4,9910 }, { 103,162,4,9914 }, { 111,162,8,9918 }, { 123,162,4,9926 }, { 133,162,4,9930 },
+	{ 141,162,4,9934 }, { 151,162,4,9938 }, { 159,162,4,9942 }, { 169,162,4,9946 }, { 177,162,4,9950 }, { 187,162,4,9954 }, { 73,167,8,9958 }, { 87,167,10,9966 },
+	{ 121,167,4,9976 }, { 131,167,4,9980 }, { 141,167,10,9984 }, { 157,167,4,9994 }, { 167,167,4,9998 }, { 73,168,8,10002 }, { 87,168,10,10010 }, { 121,168,4,10020 },
+	{ 131,168,4,10024 }, { 141,168,10,10028 }, { 157,168,4,10038 }, { 167,168,4,10042 }, { 75,169,8,10046 }, { 85,169,14,10054 }, { 121,169,6,10068 }, { 131,169,6,10074 },
+	{ 139,169,14,10080 }, { 157,169,6,10094 }, { 167,169,6,10100 }, { 75,170,8,10106 }, { 85,170,14,10114 }, { 121,170,6,10128 }, { 131,170,6,10134 }, { 139,170,14,10140 },
+	{ 157,170,6,10154 }, { 167,170,6,10160 }, { 75,171,6,10166 }, { 85,171,6,10172 }, { 97,171,4,10178 }, { 121,171,6,10182 }, { 131,171,6,10188 }, { 139,171,6,10194 },
+	{ 149,171,6,10200 }, { 157,171,6,10206 }, { 167,171,6,10212 }, { 75,172,6,10218 }, { 85,172,6,10224 }, { 97,172,4,10230 }, { 121,172,6,10234 }, { 131,172,6,10240 },
+	{ 139,172,6,10246 }, { 149,172,6,10252 }, { 157,172,6,10258 }, { 167,172,6,10264 }, { 75,173,6,10270 }, { 87,173,10,10276 }, { 123,173,4,10286 }, { 129,173,8,10290 },
+	{ 139,173,6,10298 }, { 149,173,6,10304 }, { 157,173,6,10310 }, { 167,173,6,10316 }, { 75,174,6,10322 }, { 87,174,10,10328 }, { 123,174,4,10338 }, { 129,174,8,10342 },
+	{ 139,174,6,10350 }, { 149,174,6,10356 }, { 157,174,6,10362 }, { 167,174,6,10368 }, { 75,175,6,10374 }, { 89,175,10,10380 }, { 125,175,10,10390 }, { 139,175,6,10400 },
+	{ 149,175,6,10406 }, { 157,175,6,10412 }, { 167,175,6,10418 }, { 75,176,6,10424 }, { 89,176,10,10430 }, { 125,176,10,10440 }, { 139,176,6,10450 }, { 149,176,6,10456 },
+	{ 157,176,6,10462 }, { 167,176,6,10468 }, { 75,177,6,10474 }, { 85,177,4,10480 }, { 95,177,6,10484 }, { 125,177,8,10490 }, { 139,177,6,10498 }, { 149,177,6,10504 },
+	{ 157,177,6,10510 }, { 167,177,6,10516 }, { 75,178,6,10522 }, { 85,178,4,10528 }, { 95,178,6,10532 }, { 125,178,8,10538 }, { 139,178,6,10546 }, { 149,178,6,10552 },
+	{ 157,178,6,10558 }, { 167,178,6,10564 }, { 73,179,8,10570 }, { 87,179,14,10578 }, { 125,179,8,10592 }, { 141,179,14,10600 }, { 159,179,14,10614 }, { 73,180,8,10628 },
+	{ 87,180,14,10636 }, { 125,180,8,10650 }, { 141,180,14,10658 }, { 159,180,14,10672 }, { 75,181,8,10686 }, { 89,181,10,10694 }, { 127,181,6,10704 }, { 143,181,10,10710 },
+	{ 161,181,10,10720 }, { 75,182,8,10730 }, { 89,182,10,10738 }, { 127,182,6,10748 }, { 143,182,10,10754 }, { 161,182,10,10764 }, { 11,0,16,10774 }, { 8,1,23,10790 },
+	{ 37,1,14,10813 }, { 63,1,14,10827 }, { 92,1,14,10841 }, { 120,1,12,10855 }, { 150,1,12,10867 }, { 7,2,8,10879 }, { 22,2,11,10887 }, { 36,2,15,10898 },
+	{ 62,2,15,10913 }, { 91,2,15,10928 }, { 119,2,14,10943 }, { 149,2,14,10957 }, { 5,3,6,10971 }, { 27,3,6,10977 }, { 36,3,3,10983 }, { 49,3,3,10986 },
+	{ 62,3,3,10989 }, { 75,3,3,10992 }, { 91,3,3,10995 }, { 103,3,4,10998 }, { 119,3,3,11002 }, { 130,3,3,11005 }, { 149,3,3,11008 }, { 160,3,3,11011 },
+	{ 4,4,5,11014 }, { 31,4,2,11019 }, { 36,4,3,11021 }, { 49,4,3,11024 }, { 61,4,3,11027 }, { 75,4,3,11030 }, { 90,4,3,11033 }, { 104,4,3,11036 },
+	{ 119,4,3,11039 }, { 130,4,3,11042 }, { 149,4,3,11045 }, { 160,4,3,11048 }, { 3,5,4,11051 }, { 31,5,2,11055 }, { 36,5,3,11057 }, { 49,5,4,11060 },
+	{ 61,5,3,11064 }, { 75,5,3,11067 }, { 90,5,3,11070 }, { 104,5,3,11073 }, { 119,5,3,11076 }, { 130,5,3,11079 }, { 149,5,3,11082 }, { 160,5,3,11085 },
+	{ 2,6,4,11088 }, { 31,6,2,11092 }, { 36,6,3,11094 }, { 50,6,3,11097 }, { 60,6,4,11100 }, { 75,6,3,11104 }, { 89,6,4,11107 }, { 105,6,3,11111 },
+	{ 119,6,3,11114 }, { 130,6,3,11117 }, { 149,6,3,11120 }, { 160,6,3,11123 }, { 2,7,3,11126 }, { 31,7,2,11129 }, { 36,7,3,11131 }, { 50,7,4,11134 },
+	{ 60,7,3,11138 }, { 75,7,3,11141 }, { 89,7,3,11144 }, { 105,7,3,11147 }, { 119,7,3,11150 }, { 130,7,3,11153 }, { 149,7,3,11156 }, { 160,7,3,11159 },
+	{ 1,8,4,11162 }, { 14,8,10,11166 }, { 31,8,2,11176 }, { 36,8,3,11178 }, { 51,8,3,11181 }, { 59,8,4,11184 }, { 75,8,3,11188 }, { 89,8,3,11191 },
+	{ 105,8,4,11194 }, { 119,8,3,11198 }, { 130,8,3,11201 }, { 149,8,3,11204 }, { 160,8,3,11207 }, { 1,9,3,11210 }, { 13,9,14,11213 }, { 31,9,2,11227 },
+	{ 36,9,3,11229 }, { 51,9,4,11232 }, { 59,9,3,11236 }, { 75,9,3,11239 }, { 88,9,4,11242 }, { 106,9,3,11246 }, { 119,9,3,11249 }, { 130,9,3,11252 },
+	{ 149,9,3,11255 }, { 160,9,3,11258 }, { 1,10,3,11261 }, { 12,10,5,11264 }, { 21,10,8,11269 }, { 31,10,2,11277 }, { 36,10,3,11279 }, { 52,10,3,11282 },
+	{ 59,10,3,11285 }, { 75,10,3,11288 }, { 88,10,3,11291 }, { 106,10,3,11294 }, { 119,10,3,11297 }, { 130,10,3,11300 }, { 149,10,3,11303 }, { 160,10,3,11306 },
+	{ 0,11,3,11309 }, { 12,11,3,11312 }, { 24,11,6,11315 }, { 31,11,2,11321 }, { 36,11,3,11323 }, { 52,11,3,11326 }, { 58,11,3,11329 }, { 75,11,3,11332 },
+	{ 88,11,3,11335 }, { 106,11,4,11338 }, { 119,11,3,11342 }, { 130,11,3,11345 }, { 149,11,3,11348 }, { 160,11,3,11351 }, { 0,12,3,11354 }, { 12,12,3,11357 },
+	{ 26,12,7,11360 }, { 36,12,3,11367 }, { 53,12,3,11370 }, { 58,12,3,11373 }, { 75,12,3,11376 }, { 87,12,3,11379 }, { 98,12,1,11382 }, { 107,12,3,11383 },
+	{ 119,12,3,11386 }, { 130,12,3,11389 }, { 149,12,3,11392 }, { 160,12,3,11395 }, { 0,13,3,11398 }, { 12,13,7,11401 }, { 28,13,5,11408 }, { 36,13,3,11413 },
+	{ 53,13,3,11416 }, { 57,13,3,11419 }, { 75,13,3,11422 }, { 87,13,3,11425 }, { 98,13,2,11428 }, { 107,13,3,11430 }, { 119,13,3,11433 }, { 130,13,3,11436 },
+	{ 149,13,3,11439 }, { 160,13,3,11442 }, { 0,14,3,11445 }, { 13,14,10,11448 }, { 36,14,3,11458 }, { 53,14,7,11461 }, { 75,14,3,11468 }, { 86,14,4,11471 },
+	{ 97,14,3,11475 }, { 108,14,3,11478 }, { 119,14,3,11481 }, { 130,14,3,11484 }, { 149,14,3,11487 }, { 160,14,3,11490 }, { 0,15,3,11493 }, { 15,15,11,11496 },
+	{ 36,15,3,11507 }, { 47,15,1,11510 }, { 54,15,6,11511 }, { 65,15,1,11517 }, { 75,15,3,11518 }, { 86,15,3,11521 }, { 97,15,3,11524 }, { 108,15,3,11527 },
+	{ 119,15,3,11530 }, { 130,15,3,11533 }, { 149,15,3,11536 }, { 160,15,3,11539 }, { 1,16,3,11542 }, { 20,16,9,11545 }, { 36,16,3,11554 }, { 47,16,1,11557 },
+	{ 54,16,5,11558 }, { 65,16,1,11563 }, { 75,16,3,11564 }, { 86,16,3,11567 }, { 96,16,5,11570 }, { 108,16,4,11575 }, { 119,16,3,11579 }, { 130,16,3,11582 },
+	{ 149,16,3,11585 }, { 160,16,3,11588 }, { 1,17,3,11591 }, { 23,17,7,11594 }, { 36,17,3,11601 }, { 47,17,2,11604 }, { 55,17,4,11606 }, { 64,17,2,11610 },
+	{ 75,17,3,11612 }, { 85,17,4,11615 }, { 96,17,5,11619 }, { 109,17,3,11624 }, { 119,17,3,11627 }, { 130,17,3,11630 }, { 149,17,3,11633 }, { 160,17,3,11636 },
+	{ 1,18,4,11639 }, { 26,18,5,11643 }, { 36,18,3,11648 }, { 47,18,2,11651 }, { 55,18,3,11653 }, { 64,18,2,11656 }, { 75,18,3,11658 }, { 85,18,3,11661 },
+	{ 96,18,5,11664 }, { 109,18,3,11669 }, { 119,18,3,11672 }, { 130,18,3,11675 }, { 149,18,3,11678 }, { 160,18,3,11681 }, { 2,19,3,11684 }, { 28,19,4,11687 },
+	{ 36,19,3,11691 }, { 47,19,3,11694 }, { 56,19,2,11697 }, { 63,19,3,11699 }, { 75,19,3,11702 }, { 85,19,3,11705 }, { 95,19,7,11708 }, { 109,19,4,11715 },
+	{ 119,19,3,11719 }, { 130,19,3,11722 }, { 149,19,3,11725 }, { 160,19,3,11728 }, { 2,20,4,11731 }, { 29,20,4,11735 }, { 36,20,3,11739 }, { 47,20,3,11742 },
+	{ 56,20,1,11745 }, { 63,20,3,11746 }, { 75,20,3,11749 }, { 84,20,3,11752 }, { 95,20,3,11755 }, { 99,20,3,11758 }, { 110,20,3,11761 }, { 119,20,3,11764 },
+	{ 130,20,3,11767 }, { 149,20,3,11770 }, { 160,20,3,11773 }, { 3,21,5,11776 }, { 30,21,4,11781 }, { 36,21,3,11785 }, { 47,21,3,11788 }, { 63,21,3,11791 },
+	{ 75,21,3,11794 }, { 84,21,3,11797 }, { 95,21,3,11800 }, { 99,21,3,11803 }, { 110,21,3,11806 }, { 119,21,3,11809 }, { 130,21,3,11812 }, { 149,21,3,11815 },
+	{ 160,21,3,11818 }, { 4,22,6,11821 }, { 31,22,3,11827 }, { 36,22,3,11830 }, { 47,22,4,11833 }, { 62,22,4,11837 }, { 75,22,3,11841 }, { 84,22,3,11844 },
+	{ 94,22,9,11847 }, { 111,22,3,11856 }, { 119,22,3,11859 }, { 130,22,3,11862 }, { 149,22,3,11865 }, { 160,22,3,11868 }, { 5,23,7,11871 }, { 31,23,3,11878 },
+	{ 36,23,3,11881 }, { 47,23,4,11884 }, { 62,23,4,11888 }, { 75,23,3,11892 }, { 83,23,3,11895 }, { 94,23,9,11898 }, { 111,23,3,11907 }, { 119,23,3,11910 },
+	{ 130,23,3,11913 }, { 149,23,3,11916 }, { 160,23,3,11919 }, { 7,24,10,11922 }, { 32,24,3,11932 }, { 36,24,3,11935 }, { 47,24,5,11938 }, { 61,24,5,11943 },
+	{ 75,24,3,11948 }, { 83,24,3,11951 }, { 111,24,3,11954 }, { 119,24,3,11957 }, { 130,24,3,11960 }, { 149,24,3,11963 }, { 160,24,3,11966 }, { 9,25,12,11969 },
+	{ 32,25,3,11981 }, { 36,25,3,11984 }, { 47,25,5,11987 }, { 61,25,5,11992 }, { 75,25,3,11997 }, { 82,25,4,12000 }, { 112,25,3,12004 }, { 119,25,3,12007 },
+	{ 130,25,3,12010 }, { 149,25,3,12013 }, { 160,25,3,12016 }, { 1,26,5,12019 }, { 13,26,10,12024 }, { 32,26,3,12034 }, { 36,26,3,12037 }, { 47,26,5,12040 },
+	{ 61,26,5,12045 }, { 75,26,3,12050 }, { 82,26,3,12053 }, { 112,26,3,12056 }, { 119,26,3,12059 }, { 130,26,3,12062 }, { 149,26,3,12065 }, { 160,26,3,12068 },
+	{ 0,27,7,12071 }, { 17,27,6,12078 }, { 32,27,3,12084 }, { 36,27,3,12087 }, { 47,27,2,12090 }, { 50,27,3,12092 }, { 60,27,3,12095 }, { 64,27,2,12098 },
+	{ 75,27,3,12100 }, { 82,27,3,12103 }, { 112,27,4,12106 }, { 119,27,3,12110 }, { 130,27,3,12113 }, { 149,27,3,12116 }, { 160,27,3,12119 }, { 0,28,9,12122 },
+	{ 20,28,3,12131 }, { 32,28,3,12134 }, { 36,28,3,12137 }, { 47,28,2,12140 }, { 50,28,3,12142 }, { 60,28,3,12145 }, { 64,28,2,12148 }, { 75,28,3,12150 },
+	{ 81,28,3,12153 }, { 113,28,3,12156 }, { 119,28,3,12159 }, { 130,28,3,12162 }, { 149,28,3,12165 }, { 160,28,3,12168 }, { 0,29,3,12171 }, { 5,29,6,12174 },
+	{ 20,29,3,12180 }, { 32,29,3,12183 }, { 36,29,3,12186 }, { 47,29,2,12189 }, { 51,29,3,12191 }, { 59,29,4,12194 }, { 64,29,2,12198 }, { 75,29,3,12200 },
+	{ 81,29,3,12203 }, { 113,29,3,12206 }, { 119,29,3,12209 }, { 130,29,18,12212 }, { 149,29,3,12230 }, { 160,29,18,12233 }, { 0,30,3,12251 }, { 6,30,9,12254 },
+	{ 18,30,5,12263 }, { 31,30,3,12268 }, { 36,30,3,12271 }, { 47,30,2,12274 }, { 51,30,11,12276 }, { 64,30,2,12287 }, { 75,30,3,12289 }, { 81,30,3,12292 },
+	{ 92,30,13,12295 }, { 114,30,3,12308 }, { 119,30,3,12311 }, { 130,30,22,12314 }, { 160,30,19,12336 }, { 0,31,3,12355 }, { 8,31,15,12358 }, { 31,31,3,12373 },
+	{ 36,31,3,12376 }, { 47,31,2,12379 }, { 52,31,9,12381 }, { 64,31,2,12390 }, { 75,31,3,12392 }, { 80,31,3,12395 }, { 91,31,15,12398 }, { 114,31,3,12413 },
+	{ 119,31,3,12416 }, { 146,31,6,12419 }, { 176,31,3,12425 }, { 0,32,3,12428 }, { 11,32,10,12431 }, { 30,32,4,12441 }, { 36,32,3,12445 }, { 47,32,2,12448 },
+	{ 64,32,2,12450 }, { 75,32,3,12452 }, { 80,32,3,12455 }, { 91,32,3,12458 }, { 103,32,3,12461 }, { 114,32,3,12464 }, { 119,32,3,12467 }, { 146,32,6,12470 },
+	{ 176,32,3,12476 }, { 0,33,3,12479 }, { 30,33,3,12482 }, { 36,33,3,12485 }, { 47,33,2,12488 }, { 64,33,2,12490 }, { 75,33,3,12492 }, { 79,33,4,12495 },
+	{ 91,33,3,12499 }, { 103,33,3,12502 }, { 115,33,3,12505 }, { 119,33,3,12508 }, { 146,33,6,12511 }, { 176,33,3,12517 }, { 0,34,3,12520 }, { 29,34,4,12523 },
+	{ 36,34,3,12527 }, { 47,34,2,12530 }, { 64,34,2,12532 }, { 75,34,3,12534 }, { 79,34,3,12537 }, { 90,34,3,12540 }, { 104,34,3,12543 }, { 115,34,3,12546 },
+	{ 119,34,3,12549 }, { 146,34,6,12552 }, { 176,34,3,12558 }, { 0,35,3,12561 }, { 28,35,4,12564 }, { 36,35,3,12568 }, { 47,35,2,12571 }, { 64,35,2,12573 },
+	{ 75,35,3,12575 }, { 79,35,3,12578 }, { 90,35,3,12581 }, { 104,35,3,12584 }, { 115,35,7,12587 }, { 146,35,6,12594 }, { 176,35,3,12600 }, { 0,36,4,12603 },
+	{ 26,36,5,12607 }, { 36,36,3,12612 }, { 47,36,2,12615 }, { 64,36,2,12617 }, { 75,36,6,12619 }, { 90,36,3,12625 }, { 104,36,3,12628 }, { 116,36,6,12631 },
+	{ 146,36,6,12637 }, { 176,36,3,12643 }, { 0,37,7,12646 }, { 24,37,6,12653 }, { 36,37,3,12659 }, { 47,37,2,12662 }, { 64,37,2,12664 }, { 75,37,6,12666 },
+	{ 89,37,3,12672 }, { 105,37,3,12675 }, { 116,37,6,12678 }, { 146,37,6,12684 }, { 176,37,3,12690 }, { 1,38,11,12693 }, { 20,38,8,12704 }, { 36,38,13,12712 },
+	{ 64,38,13,12725 }, { 78,38,14,12738 }, { 105,38,74,12752 }, { 4,39,22,12826 }, { 37,39,12,12848 }, { 64,39,13,12860 }, { 79,39,12,12873 }, { 106,39,12,12885 },
+	{ 120,39,28,12897 }, { 150,39,28,12925 }, { 8,40,16,12953 }, { 1,0,14,12969 }, { 27,0,14,12983 }, { 46,0,28,12997 }, { 79,0,23,13025 }, { 117,0,24,13048 },
+	{ 144,0,13,13072 }, { 166,0,13,13085 }, { 184,0,14,13098 }, { 210,0,14,13112 }, { 0,1,15,13126 }, { 26,1,15,13141 }, { 45,1,30,13156 }, { 78,1,27,13186 },
+	{ 117,1,25,13213 }, { 144,1,13,13238 }, { 166,1,13,13251 }, { 183,1,15,13264 }, { 209,1,15,13279 }, { 0,2,3,13294 }, { 13,2,3,13297 }, { 26,2,3,13300 },
+	{ 39,2,3,13303 }, { 45,2,3,13306 }, { 72,2,3,13309 }, { 78,2,3,13312 }, { 97,2,10,13315 }, { 116,2,3,13325 }, { 139,2,3,13328 }, { 144,2,2,13331 },
+	{ 155,2,2,13333 }, { 166,2,2,13335 }, { 177,2,2,13337 }, { 183,2,3,13339 }, { 196,2,3,13342 }, { 209,2,3,13345 }, { 222,2,3,13348 }, { 0,3,3,13351 },
+	{ 13,3,3,13354 }, { 25,3,3,13357 }, { 39,3,3,13360 }, { 45,3,3,13363 }, { 72,3,3,13366 }, { 78,3,3,13369 }, { 102,3,6,13372 }, { 116,3,3,13378 },
+	{ 139,3,3,13381 }, { 144,3,2,13384 }, { 155,3,2,13386 }, { 166,3,2,13388 }, { 177,3,2,13390 }, { 183,3,3,13392 }, { 196,3,3,13395 }, { 208,3,3,13398 },
+	{ 222,3,3,13401 }, { 0,4,3,13404 }, { 13,4,4,13407 }, { 25,4,3,13411 }, { 39,4,3,13414 }, { 45,4,3,13417 }, { 72,4,3,13420 }, { 78,4,3,13423 },
+	{ 104,4,6,13426 }, { 116,4,3,13432 }, { 139,4,3,13435 }, { 144,4,2,13438 }, { 155,4,2,13440 }, { 166,4,2,13442 }, { 177,4,2,13444 }, { 183,4,3,13446 },
+	{ 196,4,4,13449 }, { 208,4,3,13453 }, { 222,4,3,13456 }, { 0,5,3,13459 }, { 14,5,3,13462 }, { 24,5,4,13465 }, { 39,5,3,13469 }, { 45,5,3,13472 },
+	{ 72,5,3,13475 }, { 78,5,3,13478 }, { 106,5,5,13481 }, { 116,5,3,13486 }, { 139,5,3,13489 }, { 144,5,2,13492 }, { 155,5,2,13494 }, { 166,5,2,13496 },
+	{ 177,5,2,13498 }, { 183,5,3,13500 }, { 197,5,3,13503 }, { 207,5,4,13506 }, { 222,5,3,13510 }, { 0,6,3,13513 }, { 14,6,4,13516 }, { 24,6,3,13520 },
+	{ 39,6,3,13523 }, { 45,6,3,13526 }, { 72,6,3,13529 }, { 78,6,3,13532 }, { 107,6,5,13535 }, { 116,6,3,13540 }, { 139,6,3,13543 }, { 144,6,2,13546 },
+	{ 155,6,2,13548 }, { 166,6,2,13550 }, { 177,6,2,13552 }, { 183,6,3,13554 }, { 197,6,4,13557 }, { 207,6,3,13561 }, { 222,6,3,13564 }, { 0,7,3,13567 },
+	{ 15,7,3,13570 }, { 23,7,4,13573 }, { 39,7,3,13577 }, { 45,7,3,13580 }, { 72,7,3,13583 }, { 78,7,3,13586 }, { 108,7,4,13589 }, { 116,7,3,13593 },
+	{ 139,7,3,13596 }, { 144,7,2,13599 }, { 155,7,2,13601 }, { 166,7,2,13603 }, { 177,7,2,13605 }, { 183,7,3,13607 }, { 198,7,3,13610 }, { 206,7,4,13613 },
+	{ 222,7,3,13617 }, { 0,8,3,13620 }, { 15,8,4,13623 }, { 23,8,3,13627 }, { 39,8,3,13630 }, { 45,8,3,13633 }, { 72,8,3,13636 }, { 78,8,3,13639 },
+	{ 109,8,4,13642 }, { 117,8,8,13646 }, { 133,8,9,13654 }, { 144,8,2,13663 }, { 155,8,2,13665 }, { 166,8,2,13667 }, { 177,8,2,13669 }, { 183,8,3,13671 },
+	{ 198,8,4,13674 }, { 206,8,3,13678 }, { 222,8,3,13681 }, { 0,9,3,13684 }, { 16,9,3,13687 }, { 23,9,3,13690 }, { 39,9,3,13693 }, { 45,9,3,13696 },
+	{ 56,9,19,13699 }, { 78,9,3,13718 }, { 89,9,9,13721 }, { 110,9,4,13730 }, { 117,9,8,13734 }, { 133,9,8,13742 }, { 144,9,2,13750 }, { 155,9,2,13752 },
+	{ 166,9,2,13754 }, { 177,9,2,13756 }, { 183,9,3,13758 }, { 199,9,3,13761 }, { 206,9,3,13764 }, { 222,9,3,13767 }, { 0,10,3,13770 }, { 16,10,3,13773 },
+	{ 22,10,3,13776 }, { 39,10,3,13779 }, { 45,10,3,13782 }, { 56,10,18,13785 }, { 78,10,3,13803 }, { 89,10,11,13806 }, { 111,10,3,13817 }, { 122,10,3,13820 },
+	{ 133,10,3,13823 }, { 144,10,2,13826 }, { 155,10,2,13828 }, { 166,10,2,13830 }, { 177,10,2,13832 }, { 183,10,3,13834 }, { 199,10,3,13837 }, { 205,10,3,13840 },
+	{ 222,10,3,13843 }, { 0,11,3,13846 }, { 17,11,3,13849 }, { 22,11,3,13852 }, { 39,11,3,13855 }, { 45,11,3,13858 }, { 56,11,3,13861 }, { 78,11,3,13864 },
+	{ 89,11,3,13867 }, { 95,11,7,13870 }, { 111,11,4,13877 }, { 122,11,3,13881 }, { 133,11,3,13884 }, { 144,11,2,13887 }, { 155,11,2,13889 }, { 166,11,2,13891 },
+	{ 177,11,2,13893 }, { 183,11,3,13895 }, { 200,11,3,13898 }, { 205,11,3,13901 }, { 222,11,3,13904 }, { 0,12,3,13907 }, { 17,12,3,13910 }, { 21,12,3,13913 },
+	{ 39,12,3,13916 }, { 45,12,3,13919 }, { 56,12,3,13922 }, { 78,12,3,13925 }, { 89,12,3,13928 }, { 98,12,5,13931 }, { 112,12,3,13936 }, { 122,12,3,13939 },
+	{ 133,12,3,13942 }, { 144,12,2,13945 }, { 155,12,2,13947 }, { 166,12,2,13949 }, { 177,12,2,13951 }, { 183,12,3,13953 }, { 200,12,3,13956 }, { 204,12,3,13959 },
+	{ 222,12,3,13962 }, { 0,13,3,13965 }, { 17,13,7,13968 }, { 39,13,3,13975 }, { 45,13,3,13978 }, { 56,13,17,13981 }, { 78,13,3,13998 }, { 89,13,3,14001 },
+	{ 99,13,4,14004 }, { 112,13,3,14008 }, { 122,13,3,14011 }, { 133,13,3,14014 }, { 144,13,2,14017 }, { 155,13,2,14019 }, { 166,13,2,14021 }, { 177,13,2,14023 },
+	{ 183,13,3,14025 }, { 200,13,7,14028 }, { 222,13,3,14035 }, { 0,14,3,14038 }, { 11,14,1,14041 }, { 18,14,6,14042 }, { 29,14,1,14048 }, { 39,14,3,14049 },
+	{ 45,14,3,14052 }, { 56,14,18,14055 }, { 78,14,3,14073 }, { 89,14,3,14076 }, { 100,14,4,14079 }, { 112,14,3,14083 }, { 122,14,3,14086 }, { 133,14,3,14089 },
+	{ 144,14,2,14092 }, { 155,14,2,14094 }, { 166,14,2,14096 }, { 177,14,2,14098 }, { 183,14,3,14100 }, { 194,14,1,14103 }, { 201,14,6,14104 }, { 212,14,1,14110 },
+	{ 222,14,3,14111 }, { 0,15,3,14114 }, { 11,15,1,14117 }, { 18,15,5,14118 }, { 29,15,1,14123 }, { 39,15,3,14124 }, { 45,15,3,14127 }, { 71,15,3,14130 },
+	{ 78,15,3,14133 }, { 89,15,3,14136 }, { 101,15,3,14139 }, { 113,15,3,14142 }, { 122,15,3,14145 }, { 133,15,3,14148 }, { 144,15,2,14151 }, { 155,15,2,14153 },
+	{ 166,15,2,14155 }, { 177,15,2,14157 }, { 183,15,3,14159 }, { 194,15,1,14162 }, { 201,15,5,14163 }, { 212,15,1,14168 }, { 222,15,3,14169 }, { 0,16,3,14172 },
+	{ 11,16,2,14175 }, { 19,16,4,14177 }, { 28,16,2,14181 }, { 39,16,3,14183 }, { 45,16,3,14186 }, { 71,16,3,14189 }, { 78,16,3,14192 }, { 89,16,3,14195 },
+	{ 101,16,3,14198 }, { 113,16,3,14201 }, { 122,16,3,14204 }, { 133,16,3,14207 }, { 144,16,2,14210 }, { 155,16,2,14212 }, { 166,16,2,14214 }, { 177,16,2,14216 },
+	{ 183,16,3,14218 }, { 194,16,2,14221 }, { 202,16,4,14223 }, { 211,16,2,14227 }, { 222,16,3,14229 }, { 0,17,3,14232 }, { 11,17,2,14235 }, { 19,17,3,14237 },
+	{ 28,17,2,14240 }, { 39,17,3,14242 }, { 45,17,3,14245 }, { 71,17,3,14248 }, { 78,17,3,14251 }, { 89,17,3,14254 }, { 101,17,3,14257 }, { 113,17,3,14260 },
+	{ 122,17,3,14263 }, { 133,17,3,14266 }, { 144,17,2,14269 }, { 155,17,2,14271 }, { 166,17,2,14273 }, { 177,17,2,14275 }, { 183,17,3,14277 }, { 194,17,2,14280 },
+	{ 202,17,3,14282 }, { 211,17,2,14285 }, { 222,17,3,14287 }, { 0,18,3,14290 }, { 11,18,3,14293 }, { 20,18,2,14296 }, { 27,18,3,14298 }, { 39,18,3,14301 },
+	{ 45,18,3,14304 }, { 71,18,3,14307 }, { 78,18,3,14310 }, { 89,18,3,14313 }, { 102,18,2,14316 }, { 113,18,3,14318 }, { 122,18,3,14321 }, { 133,18,3,14324 },
+	{ 144,18,2,14327 }, { 155,18,2,14329 }, { 166,18,2,14331 }, { 177,18,2,14333 }, { 183,18,3,14335 }, { 194,18,3,14338 }, { 203,18,2,14341 }, { 210,18,3,14343 },
+	{ 222,18,3,14346 }, { 0,19,3,14349 }, { 11,19,3,14352 }, { 20,19,1,14355 }, { 27,19,3,14356 }, { 39,19,3,14359 }, { 45,19,3,14362 }, { 71,19,3,14365 },
+	{ 78,19,3,14368 }, { 89,19,3,14371 }, { 102,19,3,14374 }, { 113,19,3,14377 }, { 122,19,3,14380 }, { 133,19,3,14383 }, { 144,19,2,14386 }, { 155,19,2,14388 },
+	{ 166,19,2,14390 }, { 177,19,2,14392 }, { 183,19,3,14394 }, { 194,19,3,14397 }, { 203,19,1,14400 }, { 210,19,3,14401 }, { 222,19,3,14404 }, { 0,20,3,14407 },
+	{ 11,20,3,14410 }, { 27,20,3,14413 }, { 39,20,3,14416 }, { 45,20,3,14419 }, { 71,20,3,14422 }, { 78,20,3,14425 }, { 89,20,3,14428 }, { 102,20,2,14431 },
+	{ 113,20,3,14433 }, { 122,20,3,14436 }, { 133,20,3,14439 }, { 144,20,2,14442 }, { 155,20,2,14444 }, { 166,20,2,14446 }, { 177,20,2,14448 }, { 183,20,3,14450 },
+	{ 194,20,3,14453 }, { 210,20,3,14456 }, { 222,20,3,14459 }, { 0,21,3,14462 }, { 11,21,4,14465 }, { 26,21,4,14469 }, { 39,21,3,14473 }, { 45,21,3,14476 },
+	{ 71,21,3,14479 }, { 78,21,3,14482 }, { 89,21,3,14485 }, { 101,21,3,14488 }, { 113,21,3,14491 }, { 122,21,3,14494 }, { 133,21,3,14497 }, { 144,21,2,14500 },
+	{ 155,21,2,14502 }, { 166,21,2,14504 }, { 177,21,2,14506 }, { 183,21,3,14508 }, { 194,21,4,14511 }, { 209,21,4,14515 }, { 222,21,3,14519 }, { 0,22,3,14522 },
+	{ 11,22,4,14525 }, { 26,22,4,14529 }, { 39,22,3,14533 }, { 45,22,3,14536 }, { 56,22,18,14539 }, { 78,22,3,14557 }, { 89,22,3,14560 }, { 101,22,3,14563 },
+	{ 113,22,3,14566 }, { 122,22,3,14569 }, { 133,22,3,14572 }, { 144,22,2,14575 }, { 155,22,2,14577 }, { 166,22,2,14579 }, { 177,22,2,14581 }, { 183,22,3,14583 },
+	{ 194,22,4,14586 }, { 209,22,4,14590 }, { 222,22,3,14594 }, { 0,23,3,14597 }, { 11,23,5,14600 }, { 25,23,5,14605 }, { 39,23,3,14610 }, { 45,23,3,14613 },
+	{ 56,23,17,14616 }, { 78,23,3,14633 }, { 89,23,3,14636 }, { 101,23,3,14639 }, { 113,23,3,14642 }, { 122,23,3,14645 }, { 133,23,3,14648 }, { 144,23,2,14651 },
+	{ 155,23,2,14653 }, { 166,23,2,14655 }, { 177,23,2,14657 }, { 183,23,3,14659 }, { 194,23,5,14662 }, { 208,23,5,14667 }, { 222,23,3,14672 }, { 0,24,3,14675 },
+	{ 11,24,5,14678 }, { 25,24,5,14683 }, { 39,24,3,14688 }, { 45,24,3,14691 }, { 56,24,3,14694 }, { 78,24,3,14697 }, { 89,24,3,14700 }, { 100,24,4,14703 },
+	{ 112,24,3,14707 }, { 122,24,3,14710 }, { 133,24,3,14713 }, { 144,24,2,14716 }, { 155,24,2,14718 }, { 166,24,2,14720 }, { 177,24,2,14722 }, { 183,24,3,14724 },
+	{ 194,24,5,14727 }, { 208,24,5,14732 }, { 222,24,3,14737 }, { 0,25,3,14740 }, { 11,25,5,14743 }, { 25,25,5,14748 }, { 39,25,3,14753 }, { 45,25,3,14756 },
+	{ 56,25,3,14759 }, { 78,25,3,14762 }, { 89,25,3,14765 }, { 100,25,3,14768 }, { 112,25,3,14771 }, { 122,25,3,14774 }, { 133,25,3,14777 }, { 144,25,2,14780 },
+	{ 155,25,3,14782 }, { 165,25,3,14785 }, { 177,25,2,14788 }, { 183,25,3,14790 }, { 194,25,5,14793 }, { 208,25,5,14798 }, { 222,25,3,14803 }, { 0,26,3,14806 },
+	{ 11,26,2,14809 }, { 14,26,3,14811 }, { 24,26,3,14814 }, { 28,26,2,14817 }, { 39,26,3,14819 }, { 45,26,3,14822 }, { 56,26,3,14825 }, { 78,26,3,14828 },
+	{ 89,26,3,14831 }, { 98,26,5,14834 }, { 112,26,3,14839 }, { 122,26,3,14842 }, { 133,26,3,14845 }, { 144,26,3,14848 }, { 155,26,3,14851 }, { 165,26,3,14854 },
+	{ 176,26,3,14857 }, { 183,26,3,14860 }, { 194,26,2,14863 }, { 197,26,3,14865 }, { 207,26,3,14868 }, { 211,26,2,14871 }, { 222,26,3,14873 }, { 0,27,3,14876 },
+	{ 11,27,2,14879 }, { 14,27,3,14881 }, { 24,27,3,14884 }, { 28,27,2,14887 }, { 39,27,3,14889 }, { 45,27,3,14892 }, { 56,27,3,14895 }, { 78,27,3,14898 },
+	{ 89,27,3,14901 }, { 95,27,7,14904 }, { 111,27,3,14911 }, { 122,27,3,14914 }, { 133,27,3,14917 }, { 144,27,3,14920 }, { 155,27,3,14923 }, { 165,27,3,14926 },
+	{ 176,27,3,14929 }, { 183,27,3,14932 }, { 194,27,2,14935 }, { 197,27,3,14937 }, { 207,27,3,14940 }, { 211,27,2,14943 }, { 222,27,3,14945 }, { 0,28,3,14948 },
+	{ 11,28,2,14951 }, { 15,28,3,14953 }, { 23,28,4,14956 }, { 28,28,2,14960 }, { 39,28,3,14962 }, { 45,28,3,14965 }, { 56,28,18,14968 }, { 78,28,3,14986 },
+	{ 89,28,11,14989 }, { 111,28,3,15000 }, { 122,28,3,15003 }, { 133,28,3,15006 }, { 144,28,3,15009 }, { 155,28,5,15012 }, { 163,28,5,15017 }, { 176,28,3,15022 },
+	{ 183,28,3,15025 }, { 194,28,2,15028 }, { 198,28,3,15030 }, { 206,28,4,15033 }, { 211,28,2,15037 }, { 222,28,3,15039 }, { 0,29,3,15042 }, { 11,29,2,15045 },
+	{ 15,29,11,15047 }, { 28,29,2,15058 }, { 39,29,3,15060 }, { 45,29,3,15063 }, { 56,29,19,15066 }, { 78,29,3,15085 }, { 89,29,10,15088 }, { 110,29,3,15098 },
+	{ 117,29,8,15101 }, { 133,29,8,15109 }, { 144,29,3,15117 }, { 156,29,11,15120 }, { 176,29,3,15131 }, { 183,29,3,15134 }, { 194,29,2,15137 }, { 198,29,11,15139 },
+	{ 211,29,2,15150 }, { 222,29,3,15152 }, { 0,30,3,15155 }, { 11,30,2,15158 }, { 16,30,9,15160 }, { 28,30,2,15169 }, { 39,30,3,15171 }, { 45,30,3,15174 },
+	{ 72,30,3,15177 }, { 78,30,3,15180 }, { 109,30,4,15183 }, { 117,30,8,15187 }, { 133,30,9,15195 }, { 144,30,4,15204 }, { 157,30,9,15208 }, { 175,30,4,15217 },
+	{ 183,30,3,15221 }, { 194,30,2,15224 }, { 199,30,9,15226 }, { 211,30,2,15235 }, { 222,30,3,15237 }, { 0,31,3,15240 }, { 11,31,2,15243 }, { 28,31,2,15245 },
+	{ 39,31,3,15247 }, { 45,31,3,15250 }, { 72,31,3,15253 }, { 78,31,3,15256 }, { 108,31,4,15259 }, { 116,31,3,15263 }, { 139,31,3,15266 }, { 145,31,3,15269 },
+	{ 175,31,3,15272 }, { 183,31,3,15275 }, { 194,31,2,15278 }, { 211,31,2,15280 }, { 222,31,3,15282 }, { 0,32,3,15285 }, { 11,32,2,15288 }, { 28,32,2,15290 },
+	{ 39,32,3,15292 }, { 45,32,3,15295 }, { 72,32,3,15298 }, { 78,32,3,15301 }, { 107,32,4,15304 }, { 116,32,3,15308 }, { 139,32,3,15311 }, { 145,32,4,15314 },
+	{ 174,32,4,15318 }, { 183,32,3,15322 }, { 194,32,2,15325 }, { 211,32,2,15327 }, { 222,32,3,15329 }, { 0,33,3,15332 }, { 11,33,2,15335 }, { 28,33,2,15337 },
+	{ 39,33,3,15339 }, { 45,33,3,15342 }, { 72,33,3,15345 }, { 78,33,3,15348 }, { 106,33,4,15351 }, { 116,33,3,15355 }, { 139,33,3,15358 }, { 146,33,4,15361 },
+	{ 173,33,4,15365 }, { 183,33,3,15369 }, { 194,33,2,15372 }, { 211,33,2,15374 }, { 222,33,3,15376 }, { 0,34,3,15379 }, { 11,34,2,15382 }, { 28,34,2,15384 },
+	{ 39,34,3,15386 }, { 45,34,3,15389 }, { 72,34,3,15392 }, { 78,34,3,15395 }, { 104,34,5,15398 }, { 116,34,3,15403 }, { 139,34,3,15406 }, { 146,34,5,15409 },
+	{ 172,34,4,15414 }, { 183,34,3,15418 }, { 194,34,2,15421 }, { 211,34,2,15423 }, { 222,34,3,15425 }, { 0,35,3,15428 }, { 11,35,2,15431 }, { 28,35,2,15433 },
+	{ 39,35,3,15435 }, { 45,35,3,15438 }, { 72,35,3,15441 }, { 78,35,3,15444 }, { 102,35,6,15447 }, { 116,35,3,15453 }, { 139,35,3,15456 }, { 147,35,5,15459 },
+	{ 171,35,5,15464 }, { 183,35,3,15469 }, { 194,35,2,15472 }, { 211,35,2,15474 }, { 222,35,3,15476 }, { 0,36,3,15479 }, { 11,36,2,15482 }, { 28,36,2,15484 },
+	{ 39,36,3,15486 }, { 45,36,3,15489 }, { 72,36,3,15492 }, { 78,36,3,15495 }, { 97,36,10,15498 }, { 116,36,3,15508 }, { 139,36,3,15511 }, { 148,36,6,15514 },
+	{ 169,36,6,15520 }, { 183,36,3,15526 }, { 194,36,2,15529 }, { 211,36,2,15531 }, { 222,36,3,15533 }, { 0,37,13,15536 }, { 28,37,13,15549 }, { 45,37,30,15562 },
+	{ 78,37,27,15592 }, { 117,37,25,15619 }, { 150,37,8,15644 }, { 165,37,8,15652 }, { 183,37,13,15660 }, { 211,37,13,15673 }, { 1,38,12,15686 }, { 28,38,13,15698 },
+	{ 46,38,28,15711 }, { 79,38,23,15739 }, { 117,38,24,15762 }, { 151,38,21,15786 }, { 184,38,12,15807 }, { 211,38,13,15819 }, { 154,39,15,15832 }, { 117,0,16,15847 },
+	{ 1,1,12,15863 }, { 41,1,14,15875 }, { 69,1,25,15889 }, { 114,1,22,15914 }, { 145,1,28,15936 }, { 0,2,14,15964 }, { 40,2,15,15978 }, { 68,2,28,15993 },
+	{ 112,2,9,16021 }, { 129,2,10,16030 }, { 144,2,30,16040 }, { 0,3,3,16070 }, { 11,3,3,16073 }, { 40,3,3,16076 }, { 52,3,4,16079 }, { 68,3,3,16083 },
+	{ 90,3,7,16086 }, { 111,3,6,16093 }, { 133,3,7,16099 }, { 144,3,3,16106 }, { 171,3,3,16109 }, { 0,4,3,16112 }, { 11,4,3,16115 }, { 39,4,3,16118 },
+	{ 53,4,3,16121 }, { 68,4,3,16124 }, { 93,4,6,16127 }, { 110,4,5,16133 }, { 136,4,4,16138 }, { 144,4,3,16142 }, { 171,4,3,16145 }, { 0,5,3,16148 },
+	{ 11,5,3,16151 }, { 39,5,3,16154 }, { 53,5,3,16157 }, { 68,5,3,16160 }, { 95,5,5,16163 }, { 108,5,5,16168 }, { 138,5,3,16173 }, { 144,5,3,16176 },
+	{ 171,5,3,16179 }, { 0,6,3,16182 }, { 11,6,3,16185 }, { 38,6,4,16188 }, { 54,6,3,16192 }, { 68,6,3,16195 }, { 96,6,4,16198 }, { 108,6,4,16202 },
+	{ 138,6,3,16206 }, { 144,6,3,16209 }, { 171,6,3,16212 }, { 0,7,3,16215 }, { 11,7,3,16218 }, { 38,7,3,16221 }, { 54,7,3,16224 }, { 68,7,3,16227 },
+	{ 97,7,4,16230 }, { 107,7,4,16234 }, { 138,7,3,16238 }, { 144,7,3,16241 }, { 171,7,3,16244 }, { 0,8,3,16247 }, { 11,8,3,16250 }, { 38,8,3,16253 },
+	{ 54,8,4,16256 }, { 68,8,3,16260 }, { 98,8,3,16263 }, { 106,8,4,16266 }, { 138,8,3,16270 }, { 144,8,3,16273 }, { 171,8,3,16276 }, { 0,9,3,16279 },
+	{ 11,9,3,16282 }, { 37,9,4,16285 }, { 55,9,3,16289 }, { 68,9,3,16292 }, { 79,9,9,16295 }, { 98,9,3,16304 }, { 106,9,3,16307 }, { 121,9,10,16310 },
+	{ 138,9,3,16320 }, { 144,9,3,16323 }, { 171,9,3,16326 }, { 0,10,3,16329 }, { 11,10,3,16332 }, { 37,10,3,16335 }, { 55,10,3,16338 }, { 68,10,3,16341 },
+	{ 79,10,11,16344 }, { 99,10,3,16355 }, { 105,10,3,16358 }, { 119,10,15,16361 }, { 138,10,3,16376 }, { 144,10,3,16379 }, { 155,10,19,16382 }, { 0,11,3,16401 },
+	{ 11,11,3,16404 }, { 37,11,3,16407 }, { 55,11,4,16410 }, { 68,11,3,16414 }, { 79,11,3,16417 }, { 86,11,4,16420 }, { 99,11,3,16424 }, { 105,11,3,16427 },
+	{ 118,11,6,16430 }, { 128,11,8,16436 }, { 138,11,3,16444 }, { 144,11,3,16447 }, { 155,11,18,16450 }, { 0,12,3,16468 }, { 11,12,3,16471 }, { 36,12,3,16474 },
+	{ 47,12,1,16477 }, { 56,12,3,16478 }, { 68,12,3,16481 }, { 79,12,3,16484 }, { 87,12,3,16487 }, { 99,12,3,16490 }, { 104,12,3,16493 }, { 117,12,4,16496 },
+	{ 131,12,6,16500 }, { 138,12,3,16506 }, { 144,12,3,16509 }, { 155,12,3,16512 }, { 0,13,3,16515 }, { 11,13,3,16518 }, { 36,13,3,16521 }, { 47,13,2,16524 },
+	{ 56,13,3,16526 }, { 68,13,3,16529 }, { 79,13,3,16532 }, { 87,13,3,16535 }, { 99,13,3,16538 }, { 104,13,3,16541 }, { 116,13,4,16544 }, { 133,13,7,16548 },
+	{ 144,13,3,16555 }, { 155,13,3,16558 }, { 0,14,3,16561 }, { 11,14,3,16564 }, { 35,14,4,16567 }, { 46,14,3,16571 }, { 57,14,3,16574 }, { 68,14,3,16577 },
+	{ 79,14,3,16580 }, { 87,14,3,16583 }, { 99,14,3,16586 }, { 104,14,3,16589 }, { 116,14,3,16592 }, { 135,14,5,16595 }, { 144,14,3,16600 }, { 155,14,17,16603 },
+	{ 0,15,3,16620 }, { 11,15,3,16623 }, { 35,15,3,16626 }, { 46,15,3,16629 }, { 57,15,3,16632 }, { 68,15,3,16635 }, { 79,15,3,16638 }, { 87,15,3,16641 },
+	{ 99,15,3,16644 }, { 103,15,3,16647 }, { 115,15,3,16650 }, { 144,15,3,16653 }, { 155,15,18,16656 }, { 0,16,3,16674 }, { 11,16,3,16677 }, { 35,16,3,16680 },
+	{ 45,16,5,16683 }, { 57,16,4,16688 }, { 68,16,3,16692 }, { 79,16,3,16695 }, { 85,16,5,16698 }, { 98,16,3,16703 }, { 103,16,3,16706 }, { 115,16,3,16709 },
+	{ 144,16,3,16712 }, { 170,16,3,16715 }, { 0,17,3,16718 }, { 11,17,3,16721 }, { 34,17,4,16724 }, { 45,17,5,16728 }, { 58,17,3,16733 }, { 68,17,3,16736 },
+	{ 79,17,10,16739 }, { 98,17,3,16749 }, { 103,17,3,16752 }, { 115,17,3,16755 }, { 121,17,19,16758 }, { 144,17,3,16777 }, { 170,17,3,16780 }, { 0,18,3,16783 },
+	{ 11,18,3,16786 }, { 34,18,3,16789 }, { 45,18,5,16792 }, { 58,18,3,16797 }, { 68,18,3,16800 }, { 79,18,9,16803 }, { 97,18,4,16812 }, { 103,18,3,16816 },
+	{ 114,18,3,16819 }, { 120,18,21,16822 }, { 144,18,3,16843 }, { 170,18,3,16846 }, { 0,19,3,16849 }, { 11,19,3,16852 }, { 34,19,3,16855 }, { 44,19,7,16858 },
+	{ 58,19,4,16865 }, { 68,19,3,16869 }, { 96,19,4,16872 }, { 103,19,3,16876 }, { 114,19,3,16879 }, { 120,19,3,16882 }, { 138,19,3,16885 }, { 144,19,3,16888 },
+	{ 170,19,3,16891 }, { 0,20,3,16894 }, { 11,20,3,16897 }, { 33,20,3,16900 }, { 44,20,3,16903 }, { 48,20,3,16906 }, { 59,20,3,16909 }, { 68,20,3,16912 },
+	{ 95,20,4,16915 }, { 103,20,3,16919 }, { 114,20,3,16922 }, { 120,20,3,16925 }, { 138,20,3,16928 }, { 144,20,3,16931 }, { 170,20,3,16934 }, { 0,21,3,16937 },
+	{ 11,21,3,16940 }, { 33,21,3,16943 }, { 44,21,3,16946 }, { 48,21,3,16949 }, { 59,21,3,16952 }, { 68,21,3,16955 }, { 94,21,5,16958 }, { 103,21,3,16963 },
+	{ 114,21,3,16966 }, { 120,21,3,16969 }, { 138,21,3,16972 }, { 144,21,3,16975 }, { 170,21,3,16978 }, { 0,22,3,16981 }, { 11,22,3,16984 }, { 33,22,3,16987 },
+	{ 43,22,9,16990 }, { 60,22,3,16999 }, { 68,22,3,17002 }, { 92,22,6,17005 }, { 103,22,3,17011 }, { 114,22,3,17014 }, { 120,22,3,17017 }, { 138,22,3,17020 },
+	{ 144,22,3,17023 }, { 170,22,3,17026 }, { 0,23,3,17029 }, { 11,23,3,17032 }, { 32,23,3,17035 }, { 43,23,9,17038 }, { 60,23,3,17047 }, { 68,23,3,17050 },
+	{ 92,23,4,17053 }, { 103,23,3,17057 }, { 114,23,3,17060 }, { 120,23,3,17063 }, { 138,23,3,17066 }, { 144,23,3,17069 }, { 155,23,18,17072 }, { 0,24,3,17090 },
+	{ 11,24,3,17093 }, { 32,24,3,17096 }, { 60,24,3,17099 }, { 68,24,3,17102 }, { 93,24,4,17105 }, { 103,24,3,17109 }, { 115,24,3,17112 }, { 120,24,3,17115 },
+	{ 138,24,3,17118 }, { 144,24,3,17121 }, { 155,24,17,17124 }, { 0,25,3,17141 }, { 11,25,3,17144 }, { 31,25,4,17147 }, { 61,25,3,17151 }, { 68,25,3,17154 },
+	{ 79,25,6,17157 }, { 94,25,4,17163 }, { 103,25,3,17167 }, { 115,25,3,17170 }, { 120,25,3,17173 }, { 138,25,3,17176 }, { 144,25,3,17179 }, { 155,25,3,17182 },
+	{ 0,26,3,17185 }, { 11,26,3,17188 }, { 31,26,3,17191 }, { 61,26,3,17194 }, { 68,26,3,17197 }, { 79,26,6,17200 }, { 95,26,3,17206 }, { 104,26,3,17209 },
+	{ 115,26,3,17212 }, { 120,26,10,17215 }, { 138,26,3,17225 }, { 144,26,3,17228 }, { 155,26,3,17231 }, { 0,27,3,17234 }, { 11,27,3,17237 }, { 31,27,3,17240 },
+	{ 61,27,4,17243 }, { 68,27,3,17247 }, { 79,27,7,17250 }, { 95,27,4,17257 }, { 104,27,3,17261 }, { 116,27,3,17264 }, { 121,27,9,17267 }, { 138,27,3,17276 },
+	{ 144,27,3,17279 }, { 155,27,3,17282 }, { 0,28,3,17285 }, { 11,28,3,17288 }, { 30,28,3,17291 }, { 62,28,3,17294 }, { 68,28,3,17297 }, { 79,28,3,17300 },
+	{ 83,28,4,17303 }, { 96,28,4,17307 }, { 104,28,3,17311 }, { 116,28,4,17314 }, { 127,28,3,17318 }, { 138,28,3,17321 }, { 144,28,3,17324 }, { 155,28,3,17327 },
+	{ 0,29,3,17330 }, { 11,29,18,17333 }, { 30,29,3,17351 }, { 62,29,3,17354 }, { 68,29,3,17357 }, { 79,29,3,17360 }, { 84,29,3,17363 }, { 97,29,4,17366 },
+	{ 105,29,3,17370 }, { 117,29,5,17373 }, { 127,29,3,17378 }, { 138,29,3,17381 }, { 144,29,3,17384 }, { 155,29,18,17387 }, { 0,30,3,17405 }, { 11,30,22,17408 },
+	{ 41,30,13,17430 }, { 63,30,3,17443 }, { 68,30,3,17446 }, { 79,30,3,17449 }, { 84,30,4,17452 }, { 98,30,3,17456 }, { 105,30,3,17459 }, { 118,30,7,17462 },
+	{ 127,30,3,17469 }, { 138,30,3,17472 }, { 144,30,3,17475 }, { 155,30,19,17478 }, { 0,31,3,17497 }, { 27,31,5,17500 }, { 40,31,15,17505 }, { 63,31,3,17520 },
+	{ 68,31,3,17523 }, { 79,31,3,17526 }, { 85,31,4,17529 }, { 98,31,4,17533 }, { 105,31,4,17537 }, { 119,31,11,17541 }, { 138,31,3,17552 }, { 144,31,3,17555 },
+	{ 171,31,3,17558 }, { 0,32,3,17561 }, { 27,32,5,17564 }, { 40,32,3,17569 }, { 52,32,3,17572 }, { 63,32,3,17575 }, { 68,32,3,17578 }, { 79,32,3,17581 },
+	{ 86,32,4,17584 }, { 99,32,4,17588 }, { 106,32,4,17592 }, { 121,32,9,17596 }, { 138,32,3,17605 }, { 144,32,3,17608 }, { 171,32,3,17611 }, { 0,33,3,17614 },
+	{ 27,33,5,17617 }, { 40,33,3,17622 }, { 52,33,3,17625 }, { 64,33,3,17628 }, { 68,33,3,17631 }, { 79,33,3,17634 }, { 87,33,3,17637 }, { 100,33,4,17640 },
+	{ 107,33,4,17644 }, { 138,33,3,17648 }, { 144,33,3,17651 }, { 171,33,3,17654 }, { 0,34,3,17657 }, { 27,34,4,17660 }, { 39,34,3,17664 }, { 53,34,3,17667 },
+	{ 64,34,3,17670 }, { 68,34,3,17673 }, { 79,34,3,17676 }, { 87,34,4,17679 }, { 101,34,4,17683 }, { 107,34,5,17687 }, { 138,34,3,17692 }, { 144,34,3,17695 },
+	{ 171,34,3,17698 }, { 0,35,3,17701 }, { 27,35,4,17704 }, { 39,35,3,17708 }, { 53,35,3,17711 }, { 64,35,7,17714 }, { 79,35,3,17721 }, { 88,35,4,17724 },
+	{ 102,35,3,17728 }, { 108,35,5,17731 }, { 138,35,3,17736 }, { 144,35,3,17739 }, { 171,35,3,17742 }, { 0,36,3,17745 }, { 27,36,3,17748 }, { 39,36,3,17751 },
+	{ 53,36,3,17754 }, { 65,36,6,17757 }, { 79,36,3,17763 }, { 89,36,4,17766 }, { 102,36,4,17770 }, { 109,36,6,17774 }, { 137,36,4,17780 }, { 144,36,3,17784 },
+	{ 171,36,3,17787 }, { 0,37,3,17790 }, { 27,37,3,17793 }, { 38,37,3,17796 }, { 54,37,3,17799 }, { 65,37,6,17802 }, { 79,37,3,17808 }, { 90,37,3,17811 },
+	{ 103,37,3,17814 }, { 111,37,6,17817 }, { 133,37,7,17823 }, { 144,37,3,17830 }, { 171,37,3,17833 }, { 0,38,41,17836 }, { 54,38,28,17877 }, { 90,38,16,17905 },
+	{ 112,38,9,17921 }, { 128,38,11,17930 }, { 144,38,30,17941 }, { 1,39,39,17971 }, { 55,39,12,18010 }, { 69,39,12,18022 }, { 91,39,14,18034 }, { 114,39,22,18048 },
+	{ 145,39,28,18070 }, { 117,40,15,18098 },
+};
+
+const Color SpriteAtlas::pixels[18113] =
+{
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu,
+	0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu,
+	0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0x0000FFu,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x0000FFu, 0x0000FFu, 0x0000FFu,
+	0x0000FFu, 0x0000FFu, 0x0000FFu, 0x0000FFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u,
+	0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u, 0x008000u, 0x008000u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u,
+	0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u,
+	0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008000u,
+	0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0x008000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u,
+	0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u,
+	0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u,
+	0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u, 0x000080u,
+	0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0x000080u, 0x000080u, 0x000080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u,
+	0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u,
+	0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u, 0x800000u, 0x800000u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u,
+	0x800000u, 0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u,
+	0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u, 0x800000u, 0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u, 0x800000u,
+	0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u,
+	0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x800000u,
+	0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0x800000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u,
+	0x008080u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u,
+	0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u,
+	0x008080u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u,
+	0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u,
+	0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u,
+	0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u, 0x008080u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u,
+	0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u,
+	0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u, 0x000000u,
+	0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x000000u, 0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u, 0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u, 0x000000u, 0x000000u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x000000u, 0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u, 0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u, 0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x000000u,
+	0x000000u, 0x000000u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u,
+	0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u,
+	0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u,
+	0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u,
+	0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u,
+	0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u,
+	0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xFFFFFFu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0xFFFFFFu, 0xC0C0C0u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u,
+	0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u,
+	0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x000000u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x868482u, 0x817B77u, 0x5C524Fu,
+	0x72665Fu, 0x645955u, 0x766E69u, 0x7E7672u, 0x898684u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u,
+	0xB6AFA9u, 0x796B64u, 0x715F55u, 0x63544Cu, 0x584A43u, 0x5A4E49u, 0x4D4039u, 0x57463Du, 0x6B5B52u, 0x968F8Du, 0xBEBDBDu, 0xC0C0C0u,
+	0xC0C0C0u, 0x808080u, 0xBFBDBCu, 0xB6ADA6u, 0x766359u, 0x786255u, 0x836856u, 0x715847u, 0x544138u, 0x2D2724u, 0x342B28u, 0x4A3930u,
+	0x332D28u, 0x251C17u, 0x938E88u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xB3AAA3u, 0x978374u, 0x796357u, 0x624C3Eu, 0x503C30u, 0x3A2D25u,
+	0x352D27u, 0x3D2C27u, 0x5D4542u, 0x543932u, 0x34251Eu, 0x141312u, 0x6B6661u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x8F8374u, 0x715A4Au,
+	0x5A463Au, 0x241E1Au, 0x241D19u, 0x442A22u, 0x523127u, 0x946660u, 0xB17D77u, 0xAD756Du, 0x7B4E46u, 0x171411u, 0x54504Du, 0xC0C0C0u,
+	0xC0C0C0u, 0x808080u, 0x6D655Au, 0x3E3127u, 0x2A211Cu, 0x1D1A19u, 0x372821u, 0x885345u, 0xA76759u, 0xC28F89u, 0xB77F78u, 0xAF736Au,
+	0xA56B64u, 0x4F342Cu, 0x595550u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x817A72u, 0x36302Bu, 0x1A1817u, 0x483226u, 0x90604Eu, 0xC38676u,
+	0xD29688u, 0xC4918Bu, 0xB07971u, 0xB87F78u, 0xB2716Du, 0x7D544Au, 0x575451u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x9B9793u, 0x4E4B47u,
+	0x131311u, 0x7F5749u, 0xD69886u, 0xC89784u, 0x976C5Du, 0x794B40u, 0x9D655Du, 0x8D5D54u, 0x6A453Eu, 0x65463Au, 0x78726Eu, 0xC0C0C0u,
+	0xC0C0C0u, 0x808080u, 0xC1A39Fu, 0xA26A61u, 0x32241Bu, 0xBE9280u, 0xBE8B77u, 0x693F2Fu, 0x40241Fu, 0x5F3228u, 0xAC7A6Eu, 0x56352Fu,
+	0x2A1914u, 0x57372Bu, 0x9F9995u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xBEAFACu, 0xBE857Du, 0x986453u, 0xBC8A79u, 0xD8A495u, 0xC99C8Eu,
+	0xA87C76u, 0xB27F73u, 0xD29D92u, 0x996C69u, 0x8B5750u, 0x956560u, 0xA9A1A1u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0BFBFu, 0xC1B3B0u,
+	0xD9A291u, 0xBF8978u, 0xC78979u, 0xD6978Fu, 0xC9948Eu, 0xBF8274u, 0xD8A195u, 0xB17E7Bu, 0x9D615Au, 0x955A54u, 0xA7A0A0u, 0xC0C0C0u,
+	0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC1BCBCu, 0xC28F85u, 0xBF8B76u, 0xBB8772u, 0xAC6D5Du, 0xA6665Bu, 0xB57569u, 0x91594Bu, 0x73453Cu,
+	0x7B4C44u, 0x7A4D3Eu, 0xAAA6A6u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xB9B0AFu, 0xAD7C6Bu, 0xB9806Du, 0xB88873u,
+	0xA7796Au, 0xA0665Du, 0x915149u, 0x61332Fu, 0x7B564Bu, 0x866559u, 0xB6B4B4u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0xAA9691u, 0x966457u, 0x996455u, 0xB17C6Au, 0xB87A6Fu, 0x8D4948u, 0x824B47u, 0x7A4F41u, 0x9A8F8Eu, 0xC0C0C0u, 0xC0C0C0u,
+	0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xA79A97u, 0x805C50u, 0xA46D5Bu, 0xB87C6Du, 0xA66C66u, 0x945B51u,
+	0x836C64u, 0xBEBEBEu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xB6B1AFu,
+	0x98857Eu, 0x815D56u, 0x835852u, 0x7D605Bu, 0xB2AEADu, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0xC0C0C0u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x868482u, 0x817B77u, 0x5C524Fu, 0x72665Fu, 0x645955u, 0x766E69u, 0x7E7672u, 0x898684u, 0x808080u, 0x808080u, 0x808080u,
+	0x808080u, 0x808080u, 0xFF0000u, 0xFF0000u, 0xDC3B35u, 0x7D605Au, 0x715F55u, 0x63544Cu, 0x584A43u, 0x5A4E49u, 0x4D4039u, 0x57463Du,
+	0x6C5950u, 0xAA514Fu, 0xFA0707u, 0xFF0000u, 0xFF0000u, 0x808080u, 0xF90C0Bu, 0xDB3E37u, 0x766359u, 0x786255u, 0x836856u, 0x715847u,
+	0x544138u, 0x2D2724u, 0x342B28u, 0x4A3930u, 0x332D28u, 0x251C17u, 0xB7221Du, 0xFF0000u, 0xFF0000u, 0x808080u, 0xDA352Eu, 0xA26253u,
+	0x796357u, 0x624C3Eu, 0x503C30u, 0x3A2D25u, 0x352D27u, 0x3D2C27u, 0x5D4542u, 0x543932u, 0x34251Eu, 0x141312u, 0x831D18u, 0xFF0000u,
+	0xFF0000u, 0x808080u, 0xA53F31u, 0x725647u, 0x5A463Au, 0x241E1Au, 0x241D19u, 0x442A22u, 0x523127u, 0x946660u, 0xB17D77u, 0xAD756Du,
+	0x7B4E46u, 0x171411u, 0x661815u, 0xFF0000u, 0xFF0000u, 0x808080u, 0x7E3227u, 0x3E3127u, 0x2A211Cu, 0x1D1A19u, 0x372821u, 0x885345u,
+	0xA76759u, 0xC28F89u, 0xB77F78u, 0xAF736Au, 0xA56B64u, 0x4F342Cu, 0x6C1B16u, 0xFF0000u, 0xFF0000u, 0x808080u, 0x9A2C24u, 0x392620u,
+	0x1A1817u, 0x483226u, 0x90604Eu, 0xC38676u, 0xD29688u, 0xC4918Bu, 0xB07971u, 0xB87F78u, 0xB2716Du, 0x7D544Au, 0x6B1612u, 0xFF0000u,
+	0xFF0000u, 0x808080u, 0xC12420u, 0x592A26u, 0x131311u, 0x7F5749u, 0xD69886u, 0xC89784u, 0x976C5Du, 0x794B40u, 0x9D655Du, 0x8D5D54u,
+	0x6A453Eu, 0x65463Au, 0x92221Eu, 0xFF0000u, 0xFF0000u, 0x808080u, 0xE33C38u, 0xAB5148u, 0x32241Bu, 0xBE9280u, 0xBE8B77u, 0x693F2Fu,
+	0x40241Fu, 0x5F3228u, 0xAC7A6Eu, 0x56352Fu, 0x2A1914u, 0x57372Bu, 0xC32A27u, 0xFF0000u, 0xFF0000u, 0x808080u, 0xE53734u, 0xCA625Au,
+	0x986453u, 0xBC8A79u, 0xD8A495u, 0xC99C8Eu, 0xA87C76u, 0xB27F73u, 0xD29D92u, 0x996C69u, 0x8B5750u, 0x956560u, 0xD4201Fu, 0xFF0000u,
+	0xFF0000u, 0x808080u, 0xFB0A0Au, 0xE6423Fu, 0xD9A291u, 0xBF8978u, 0xC78979u, 0xD6978Fu, 0xC9948Eu, 0xBF8274u, 0xD8A195u, 0xB17E7Bu,
+	0x9D615Au, 0x955A54u, 0xD31919u, 0xFF0000u, 0xFF0000u, 0x808080u, 0xFF0000u, 0xF91110u, 0xC87B71u, 0xBF8B76u, 0xBB8772u, 0xAC6D5Du,
+	0xA6665Bu, 0xB57569u, 0x91594Bu, 0x73453Cu, 0x7B4C44u, 0x7A4D3Eu, 0xDA1414u, 0xFF0000u, 0xFF0000u, 0x808080u, 0xFF0000u, 0xFF0000u,
+	0xEC1311u, 0xB26E5Du, 0xB9806Du, 0xB88873u, 0xA7796Au, 0xA0665Du, 0x915149u, 0x61332Fu, 0x7B564Bu, 0x8E4D40u, 0xEE0A0Bu, 0xFF0000u,
+	0xFF0000u, 0x808080u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xCE2823u, 0x966457u, 0x996455u, 0xB17C6Au, 0xB87A6Fu, 0x8D4948u, 0x824B47u,
+	0x7A4F41u, 0xB9312Fu, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0x808080u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0xD01E1Au, 0x854D41u,
+	0xA46D5Bu, 0xB87C6Du, 0xA66C66u, 0x945B51u, 0x94372Fu, 0xFB0303u, 0xFF0000u, 0xFF0000u, 0xFF0000u, 0x808080u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xFF0000u, 0xFF0000u, 0xEC0B0Au, 0xB52E27u, 0x884841u, 0x874C46u, 0x8C312Cu, 0xE90807u, 0xFF0000u, 0xFF0000u, 0xFF0000u,
+	0xFF0000u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu,
+	0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu,
+	0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu,
+	0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu,
+	0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu,
+	0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u,
+	0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu, 0x21006Bu, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0xFFDE00u, 0x21006Bu,
+	0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u,
+	0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u,
+	0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0xDE9400u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu,
+	0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu,
+	0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u,
+	0xDE4A00u, 0x21006Bu, 0x21006Bu, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0xDE4A00u, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu,
+	0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x21006Bu, 0x303030u, 0x50373Fu, 0x503740u,
+	0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x50373Fu,
+	0x573B44u, 0x573738u, 0x503740u, 0x4F3000u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u,
+	0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x4E2F3Bu, 0x303030u, 0x707770u, 0x303030u, 0x503740u, 0x503740u,
+	0x503740u, 0x707000u, 0x7F785Fu, 0x808760u, 0x7F785Fu, 0x70672Fu, 0x5F574Fu, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x50373Fu,
+	0x5F3F00u, 0x5C3C24u, 0x503740u, 0x4F3000u, 0x573738u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u,
+	0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x50373Fu, 0x303030u, 0x707770u, 0x303030u, 0x5D3846u, 0x5F3F40u,
+	0x5F3F40u, 0x707000u, 0xA0A000u, 0xBFB800u, 0x9F9F00u, 0x7F785Fu, 0x606000u, 0x5F3F40u, 0x5F3840u, 0x5F3840u, 0x573738u, 0x503740u,
+	0x774D2Fu, 0x5F3F00u, 0x5F3F00u, 0x4F3000u, 0x5D3846u, 0x573738u, 0x503740u, 0x573738u, 0x503740u, 0x573738u, 0x503740u, 0x573738u,
+	0x503740u, 0x573738u, 0x503740u, 0x573738u, 0x503740u, 0x573738u, 0x503740u, 0x303030u, 0x9F9FD0u, 0x707770u, 0x303030u, 0x5F3F40u,
+	0x6F3850u, 0x703F60u, 0x7F785Fu, 0xAFAF00u, 0xDFDF00u, 0xB0B040u, 0x8F8F20u, 0x606700u, 0x6F3850u, 0x63394Du, 0x60384Fu, 0x5D3846u,
+	0x503740u, 0x805700u, 0x5F3F00u, 0x604000u, 0x4F3000u, 0x63394Du, 0x573738u, 0x5D3846u, 0x573738u, 0x5D3846u, 0x573738u, 0x5D3846u,
+	0x573738u, 0x5D3846u, 0x573738u, 0x5D3846u, 0x573738u, 0x5D3846u, 0x573738u, 0x573738u, 0x303030u, 0xB0B7DFu, 0x9F9FD0u, 0x707770u,
+	0x303030u, 0x703F60u, 0x7F3F60u, 0x703F60u, 0x7F785Fu, 0xAFAF00u, 0xD0D000u, 0xB0B040u, 0x8F8F20u, 0x606700u, 0x703F60u, 0x6F384Cu,
+	0x63394Du, 0x63394Du, 0x503740u, 0x805700u, 0x664621u, 0x604000u, 0x4F3000u, 0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du,
+	0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du, 0x63394Du, 0x573B44u, 0x303030u, 0xC0C7DFu,
+	0xB0B7DFu, 0x9F9FD0u, 0x707770u, 0x3F3F3Fu, 0x7F3F60u, 0x80476Fu, 0x703F60u, 0x7F785Fu, 0x8F8F20u, 0xA0A000u, 0x8F8800u, 0x7F785Fu,
+	0x606700u, 0x703F60u, 0x703F60u, 0x703F60u, 0x703F60u, 0x5F3840u, 0x805700u, 0x6F4D23u, 0x604000u, 0x4F3000u, 0x6F3F5Fu, 0x703F60u,
+	0x733D59u, 0x703F60u, 0x733D59u, 0x703F60u, 0x733D59u, 0x703F60u, 0x733D59u, 0x703F60u, 0x733D59u, 0x703F60u, 0x733D59u, 0x6F3F5Fu,
+	0x63394Du, 0x303030u, 0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x6F6F6Fu, 0x3F3F3Fu, 0x90477Fu, 0x9F478Fu, 0x9F478Fu, 0x9F4780u,
+	0x9F4780u, 0x9F4780u, 0x9F4780u, 0x9F4780u, 0x97457Du, 0x90477Fu, 0x90477Fu, 0x90477Fu, 0x90477Fu, 0x7F3F60u, 0x805700u, 0x6F4D23u,
+	0x604000u, 0x4F3000u, 0x7F3F60u, 0x8F4780u, 0x97457Du, 0x97457Du, 0x97457Du, 0x97457Du, 0x97457Du, 0x97457Du, 0x97457Du, 0x97457Du,
+	0x97457Du, 0x97457Du, 0x97457Du, 0x80486Fu, 0x63394Du, 0x303030u, 0xCFCFE0u, 0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x606700u,
+	0x703F60u, 0xD070D0u, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu,
+	0xCF4FBFu, 0xAF509Fu, 0x704F00u, 0xA06800u, 0x906000u, 0x7F5000u, 0x6F3850u, 0x90578Fu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu,
+	0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xCF4FBFu, 0xAF4F9Fu, 0x6F3F5Fu, 0x303030u, 0xDFDFEFu,
+	0xDFDFEFu, 0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x3F3F3Fu, 0xFFFFFFu, 0xFFD7FFu, 0xFFC0FFu, 0xFFB0FFu, 0xFF9FFFu, 0xFF9FFFu,
+	0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xEF88EFu, 0xAF57A0u, 0x7F6F50u, 0xDBBD7Bu, 0xA97F29u, 0x7F571Fu,
+	0x6F4800u, 0xEF88EFu, 0xEF88EFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu, 0xFF8FFFu,
+	0xFF8FFFu, 0xEF88EFu, 0x90678Fu, 0x303030u, 0x3F3F3Fu, 0xDFDFEFu, 0xE0E7E0u, 0xDFDFEFu, 0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu, 0x3F3F3Fu,
+	0xFF9FFFu, 0xCF5FC0u, 0xB047A0u, 0xCF5FC0u, 0x9F478Fu, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u,
+	0xCF5FC0u, 0xBF5FAFu, 0x5F574Fu, 0xB58E3Eu, 0x7F5000u, 0x7F5000u, 0x302700u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u,
+	0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xCF5FC0u, 0xAF4F90u, 0x303030u, 0x707770u, 0x3F3F3Fu,
+	0xDFDFEFu, 0xE0E7E0u, 0xDFDFEFu, 0xCFCFE0u, 0xC0C7DFu, 0x3F3F3Fu, 0xD070D0u, 0xB047A0u, 0xF0F000u, 0xB047A0u, 0xE0E02Fu, 0xB047A0u,
+	0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xA04F90u, 0x5F574Fu, 0x8F5F00u, 0x704800u, 0x503000u,
+	0x302700u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u, 0xB047A0u,
+	0xB047A0u, 0xB047A0u, 0x9F4880u, 0x303030u, 0x707770u, 0x3F3F3Fu, 0xDFDFEFu, 0xE0E7E0u, 0xDFDFEFu, 0xCFCFE0u, 0x3F3F3Fu, 0xAF50A0u,
+	0x9F478Fu, 0xD0D73Fu, 0x9F478Fu, 0xDFDF00u, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu,
+	0x8F487Fu, 0x5F574Fu, 0x704800u, 0x503000u, 0x503000u, 0x302700u, 0x8F487Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu,
+	0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x95477Fu, 0x8F4080u, 0x8F4870u, 0x303030u, 0x9F9FD0u, 0x707770u, 0x3F3F3Fu,
+	0xD0D7EFu, 0xE0E7E0u, 0xDFDFEFu, 0x3F3F3Fu, 0x9F478Fu, 0x80476Fu, 0xB0B730u, 0x80476Fu, 0xB0B730u, 0x80476Fu, 0x7F416Fu, 0x80476Fu,
+	0x7F416Fu, 0x80476Fu, 0x7F416Fu, 0x80476Fu, 0x7F416Fu, 0x6F4750u, 0x5F574Fu, 0x303030u, 0x505000u, 0x303030u, 0x302700u, 0x6F4750u,
+	0x7F416Fu, 0x80476Fu, 0x7F416Fu, 0x80476Fu, 0x7F416Fu, 0x80476Fu, 0x7F416Fu, 0x80476Fu, 0x7F416Fu, 0x80476Fu, 0x7F416Fu, 0x7F416Fu,
+	0x783F68u, 0x303030u, 0xB0B7DFu, 0x9F9FD0u, 0x707770u, 0x3F3F3Fu, 0xD0D7EFu, 0xE0E7E0u, 0x3F3F3Fu, 0x6F4750u, 0x6F4750u, 0x80872Fu,
+	0x6F3F5Fu, 0x80872Fu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x604050u, 0x4F484Fu, 0x4F484Fu,
+	0x4F484Fu, 0xFFFFFFu, 0x808780u, 0x3F3F3Fu, 0x4F484Fu, 0x503F3Fu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu,
+	0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x6B3D5Bu, 0x303030u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x707770u, 0x3F3F3Fu,
+	0xD0D7EFu, 0x3F3F3Fu, 0x503740u, 0x503740u, 0x4F484Fu, 0x503740u, 0x4F484Fu, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u,
+	0x503740u, 0x503740u, 0x503740u, 0x4F484Fu, 0xFFFFFFu, 0xF0F0F0u, 0xAFA8AFu, 0x909090u, 0xCFCFCFu, 0x909090u, 0x202720u, 0x503740u,
+	0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x503740u, 0x303030u,
+	0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x707770u, 0x3F3F3Fu, 0x0F0F0Fu, 0x4F484Fu, 0xC0C0C0u, 0x0F0F0Fu, 0x6F6F6Fu, 0x6F6F6Fu,
+	0x0F0F0Fu, 0x6F6F6Fu, 0x202720u, 0xCFCFE0u, 0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x606700u, 0x3F3F3Fu, 0x00075Fu, 0x00075Fu,
+	0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x4F484Fu,
+	0xC0C0C0u, 0x100F00u, 0x606060u, 0x3F3F3Fu, 0x100F00u, 0x6F6F6Fu, 0x202720u, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu,
+	0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x303030u, 0xDFDFEFu, 0xDFDFEFu, 0xCFCFE0u, 0xC0C7DFu,
+	0xB0B7DFu, 0x9F9FD0u, 0x3F3F3Fu, 0xFFFFFFu, 0x90B8FFu, 0x6F9FFFu, 0x3F80FFu, 0x2F70FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu,
+	0x0058FFu, 0x0058FFu, 0x2038F0u, 0x2028D0u, 0x4F484Fu, 0xC0C0C0u, 0x201800u, 0x4F484Fu, 0x3F3F3Fu, 0x201800u, 0x6F6F6Fu, 0x202720u,
+	0x2028D0u, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x0058FFu, 0x3037FFu,
+	0x303030u, 0x3F3F3Fu, 0xDFDFEFu, 0xE0E7E0u, 0xDFDFEFu, 0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu, 0x3F3F3Fu, 0x6F9FFFu, 0x2038F0u, 0x2027C0u,
+	0x2038F0u, 0x1F18A0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2028D0u, 0x4F484Fu, 0xDFD8DFu,
+	0x3F2700u, 0x0F0F0Fu, 0x0F0F0Fu, 0x3F2700u, 0x6F6F6Fu, 0x202720u, 0x2028D0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u,
+	0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x2038F0u, 0x3030EFu, 0x303030u, 0x7F7F7Fu, 0x3F3F3Fu, 0xDFDFEFu, 0xE0E7E0u, 0xDFDFEFu,
+	0xCFCFE0u, 0xC0C7DFu, 0x3F3F3Fu, 0x0058FFu, 0x2028D0u, 0xF0F000u, 0x2028D0u, 0xE0E02Fu, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u,
+	0x2028D0u, 0x2028D0u, 0x2028D0u, 0x1F27C0u, 0x4F484Fu, 0x909090u, 0x505000u, 0x3F3F3Fu, 0x3F3F3Fu, 0x505000u, 0x606060u, 0x202720u,
+	0x1F27C0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u, 0x2028D0u,
+	0x303030u, 0x7F7F7Fu, 0x3F3F3Fu, 0xDFDFEFu, 0xE0E7E0u, 0xDFDFEFu, 0xCFCFE0u, 0x3F3F3Fu, 0x2028D0u, 0x2027C0u, 0xD0D73Fu, 0x2027C0u,
+	0xDFDF00u, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F18A0u, 0x3F3F3Fu, 0x3F3F3Fu, 0x202720u,
+	0x202720u, 0x202720u, 0x202720u, 0x202720u, 0x00075Fu, 0x1F18A0u, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu,
+	0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x1F20BFu, 0x303030u, 0x9F9FD0u, 0x7F7F7Fu, 0x3F3F3Fu, 0xD0D7EFu, 0xE0E7E0u, 0xDFDFEFu,
+	0x3F3F3Fu, 0x1F18A0u, 0x2027C0u, 0xB0B730u, 0x1F18A0u, 0xB0B730u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u,
+	0x1F18A0u, 0x1F18A0u, 0x1F1790u, 0x0F0F7Fu, 0xB67C14u, 0xAF7000u, 0x8F5F00u, 0x7F571Fu, 0x0F0F7Fu, 0x1F1790u, 0x1F18A0u, 0x1F18A0u,
+	0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x1F18A0u, 0x303030u, 0xB0B7DFu,
+	0x9F9FD0u, 0x7F7F7Fu, 0x3F3F3Fu, 0xD0D7EFu, 0xE0E7E0u, 0x3F3F3Fu, 0x0F0F7Fu, 0x1F18A0u, 0x80872Fu, 0x0F0F7Fu, 0x80872Fu, 0x0F0F7Fu,
+	0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x5F3F00u, 0x4F3000u, 0x4F3000u,
+	0x503000u, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu,
+	0x0F0F7Fu, 0x0F0F7Fu, 0x0F0F7Fu, 0x303030u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x7F7F7Fu, 0x3F3F3Fu, 0xD0D7EFu, 0x303030u, 0x00075Fu,
+	0x00075Fu, 0x4F484Fu, 0x00075Fu, 0x4F484Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu,
+	0x00075Fu, 0x00075Fu, 0x8F5F00u, 0x603F00u, 0x603F00u, 0x4C2E28u, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu,
+	0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x00075Fu, 0x303030u, 0xCFCFE0u, 0xC0C7DFu, 0xB0B7DFu,
+	0x9F9FD0u, 0x7F7F7Fu, 0x3F3F3Fu, 0x0F0F0Fu, 0xAF7000u, 0x8F5F00u, 0x6F4800u, 0x573237u, 0xDFDFEFu, 0xD3D3E3u, 0xC0C7DFu, 0xB0B7DFu,
+	0x9F9FD0u, 0x606700u, 0x2F3F1Fu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu,
+	0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x2F3F1Fu, 0xAF7F30u, 0x9F6700u, 0x815B26u, 0x573237u, 0x0B4C2Bu, 0x0B4C2Bu,
+	0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu, 0x0B4C2Bu,
+	0x2F3F1Fu, 0x7F7F7Fu, 0xDFDFEFu, 0xDFDFEFu, 0xD3D3E3u, 0xC0C7DFu, 0xB0B7DFu, 0x9F9FD0u, 0x2F3F1Fu, 0xFFFFFFu, 0xB0FFC0u, 0x8FFF6Fu,
+	0x00FF00u, 0x00E700u, 0x00E700u, 0x00E700u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x3FD830u, 0x30C72Fu, 0x10AF0Fu,
+	0xAF7000u, 0xA06800u, 0x8F5F00u, 0x4F3000u, 0x10AF0Fu, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u,
+	0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00DF00u, 0x00B800u, 0x2F3F1Fu, 0x2F3F1Fu, 0x7F7F7Fu, 0xE0E7E0u, 0xDFDFEFu, 0xD3D3E3u,
+	0xC0C7DFu, 0xB0B7DFu, 0x2F3F1Fu, 0x00E700u, 0x0FC000u, 0x009870u, 0x0FC000u, 0x009870u, 0x00B87Fu, 0x0FC000u, 0x0FC000u, 0x0FC000u,
+	0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x109F0Fu, 0xAF7000u, 0x8F5F00u, 0x805700u, 0x4F3000u, 0x109F0Fu, 0x0FC000u,
+	0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u, 0x0FC000u,
+	0x2F3F1Fu, 0x2F3F1Fu, 0x808780u, 0xE0E7E0u, 0xDFDFEFu, 0xCFCFE0u, 0xC0C7DFu, 0x2F3F1Fu, 0x00B800u, 0x10AF0Fu, 0xDFDF00u, 0x10A70Fu,
+	0xE0E02Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10870Fu, 0x93692Au,
+	0x8F5830u, 0x7F4820u, 0x4F3000u, 0x10900Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu,
+	0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x10A70Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x909090u, 0xE0E7E0u, 0xDFDFEFu, 0xCFCFE0u, 0x2F3F1Fu,
+	0x009700u, 0x1F8F0Fu, 0xD0D73Fu, 0x1F8F0Fu, 0xDFDF00u, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu,
+	0x1F8F0Fu, 0x1F8F0Fu, 0x1F7710u, 0x8F5830u, 0x7F4820u, 0x664621u, 0x4F3000u, 0x10870Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu,
+	0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x1F8F0Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x909090u,
+	0xE0E7E0u, 0xDFDFEFu, 0x2F3F1Fu, 0x1F7710u, 0x1F7710u, 0xAFA820u, 0x1F7710u, 0xAFA820u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u,
+	0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x205F10u, 0x7F4820u, 0x6F381Fu, 0x5F3F00u, 0x4F3000u, 0x306F2Fu, 0x1F7710u,
+	0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u, 0x1F7710u,
+	0x2F3F1Fu, 0x2F3F1Fu, 0x909090u, 0xE0E7E0u, 0x2F3F1Fu, 0x304F00u, 0x205F10u, 0x707000u, 0x205F10u, 0x707000u, 0x205F10u, 0x205F10u,
+	0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x304F00u, 0x6F381Fu, 0x5F3F00u, 0x4F3000u, 0x4C2E28u,
+	0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u, 0x205F10u,
+	0x205F10u, 0x205F10u, 0x2F3F1Fu, 0x20301Fu, 0x808780u, 0x2F381Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x40471Fu, 0x2F3F1Fu, 0x40471Fu, 0x2F3F1Fu,
+	0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F381Fu, 0x4E2F3Bu, 0x402800u, 0x402800u,
+	0x402800u, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu,
+	0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0x2F3F1Fu, 0xFFA347u, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu,
+	0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x0F0F0Fu, 0x0F0F0Fu, 0x0F0F0Fu,
+	0x0F0F0Fu, 0x0F0F0Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu, 0x20301Fu,
+	0x20301Fu, 0x20301Fu, 0x20301Fu, 0x2F381Fu, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u, 0xFFA347u,
+	0xFFA347u, 0xFFA347u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au,
+	0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x00004Au, 0x2A2A2Au, 0x666666u,
+	0x787878u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x909090u, 0x787878u,
+	0x666666u, 0x2A2A2Au, 0x080808u, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xEFEFEFu, 0xB2B2B2u, 0x565656u,
+	0x191919u, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x6E6E6Eu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x7F7F7Fu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xEFEFEFu, 0xB2B2B2u, 0x1B1B1Bu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x7F7F7Fu, 0xDADADAu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x999999u, 0x888888u, 0x666666u, 0x333333u, 0x888888u, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xC3C3C3u, 0x2C2C2Cu, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x6E6E6Eu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xB2B2B2u, 0x3B3B3Bu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFCFCFCu,
+	0x2A2A2Au, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFCFCFCu, 0x2A2A2Au, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xBBBBBBu, 0x666666u, 0x111111u, 0x888888u, 0xAAAAAAu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0x555555u,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x2A2A2Au, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x2C2C2Cu, 0xEBEBEBu,
+	0xFFFFFFu, 0xDDDDDDu, 0x444444u, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0x4C4C4Cu,
+	0xFFFFFFu, 0xDDDDDDu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x7F7F7Fu, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x2C2C2Cu,
+	0xFCFCFCu, 0xFFFFFFu, 0xAAAAAAu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu,
+	0xB2B2B2u, 0xFFFFFFu, 0x777777u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0x444444u, 0xFFFFFFu, 0xC3C3C3u,
+	0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u,
+	0x1B1B1Bu, 0xEBEBEBu, 0xFFFFFFu, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0xB2B2B2u,
+	0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x080808u, 0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0xDDDDDDu,
+	0xFFFFFFu, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0xB2B2B2u, 0xFFFFFFu, 0xAAAAAAu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u, 0xFFFFFFu,
+	0xFCFCFCu, 0x2A2A2Au, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x5D5D5Du, 0xFFFFFFu, 0xBBBBBBu, 0x888888u,
+	0xFFFFFFu, 0xA1A1A1u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x333333u, 0x888888u, 0xEEEEEEu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xCCCCCCu, 0x888888u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0x909090u,
+	0x191919u, 0xEBEBEBu, 0xFFFFFFu, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xB2B2B2u, 0xFFFFFFu, 0x666666u, 0x222222u, 0xFFFFFFu,
+	0xDEDEDEu, 0x080808u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x909090u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x999999u, 0x333333u, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x333333u, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0x7F7F7Fu, 0xFFFFFFu, 0xAAAAAAu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x2A2A2Au, 0xFFFFFFu,
+	0xEEEEEEu, 0x111111u, 0xBBBBBBu, 0xFFFFFFu, 0x5D5D5Du, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0x888888u, 0xFFFFFFu, 0xFCFCFCu, 0x909090u,
+	0x3B3B3Bu, 0x3B3B3Bu, 0x787878u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x222222u, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xBBBBBBu, 0xFFFFFFu, 0x6E6E6Eu, 0xC9C9C9u, 0xFFFFFFu, 0x444444u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x7F7F7Fu,
+	0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x121212u, 0xFFFFFFu, 0xEEEEEEu, 0xCCCCCCu, 0xFFFFFFu, 0x3B3B3Bu, 0x2A2A2Au,
+	0x909090u, 0xEBEBEBu, 0xFFFFFFu, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x555555u, 0xFFFFFFu,
+	0xC3C3C3u, 0x5D5D5Du, 0xFFFFFFu, 0xCCCCCCu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x111111u, 0xEEEEEEu,
+	0xFFFFFFu, 0x2A2A2Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0xDDDDDDu, 0xFFFFFFu, 0x4C4C4Cu, 0x191919u, 0xA1A1A1u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x4C4C4Cu, 0xC3C3C3u, 0xFFFFFFu, 0x666666u,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0x444444u, 0x999999u, 0xFFFFFFu, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x454545u, 0xFFFFFFu,
+	0xBBBBBBu, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x909090u, 0x666666u, 0x2A2A2Au, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xC3C3C3u,
+	0x2C2C2Cu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x777777u, 0xFFFFFFu, 0xB2B2B2u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0xDDDDDDu, 0x111111u, 0x444444u, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu,
+	0x777777u, 0xEEEEEEu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0x3B3B3Bu, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0xB2B2B2u, 0xFFFFFFu, 0x888888u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x080808u,
+	0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0x555555u, 0xFFFFFFu, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x121212u, 0xFFFFFFu, 0xEEEEEEu,
+	0x333333u, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xEFEFEFu, 0xB2B2B2u, 0x3B3B3Bu, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x666666u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x555555u, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0x5D5D5Du, 0xFFFFFFu, 0xBBBBBBu, 0x999999u, 0xFFFFFFu, 0xAAAAAAu, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xCCCCCCu, 0xFFFFFFu,
+	0x333333u, 0x888888u, 0x888888u, 0xDDDDDDu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC9C9C9u, 0x7F7F7Fu, 0x080808u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xBBBBBBu, 0x222222u, 0xFFFFFFu, 0xFCFCFCu, 0xFFFFFFu, 0x999999u, 0xBBBBBBu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xB2B2B2u,
+	0xFFFFFFu, 0x666666u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x222222u, 0xFFFFFFu, 0xDEDEDEu, 0x080808u, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x909090u,
+	0xFFFFFFu, 0x888888u, 0x111111u, 0x888888u, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xDADADAu, 0x6E6E6Eu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0xFFFFFFu, 0x333333u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0x222222u, 0x222222u, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x2A2A2Au,
+	0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x555555u, 0xFFFFFFu, 0xB2B2B2u, 0xFFFFFFu, 0x666666u, 0xBBBBBBu, 0xFFFFFFu, 0x5D5D5Du, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu,
+	0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu,
+	0x999999u, 0x444444u, 0xFFFFFFu, 0xBBBBBBu, 0x888888u, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x7F7F7Fu, 0xFFFFFFu, 0x999999u,
+	0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0xFFFFFFu, 0xAAAAAAu, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xB2B2B2u, 0xFFFFFFu, 0xAAAAAAu, 0x555555u,
+	0xFFFFFFu, 0xFFFFFFu, 0xA7A7A7u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0xBBBBBBu, 0x444444u, 0x111111u,
+	0xEEEEEEu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x191919u,
+	0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x191919u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x1B1B1Bu, 0xEBEBEBu, 0xFFFFFFu, 0x999999u, 0x333333u,
+	0xEEEEEEu, 0xFFFFFFu, 0x909090u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x777777u, 0x444444u, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0xB2B2B2u, 0xFFFFFFu,
+	0x666666u, 0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x2C2C2Cu, 0xFCFCFCu, 0xFFFFFFu, 0xBBBBBBu, 0x222222u, 0x333333u, 0xFFFFFFu, 0xFCFCFCu,
+	0x2A2A2Au, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0xAAAAAAu, 0xFFFFFFu, 0x5D5D5Du, 0x5D5D5Du, 0xFFFFFFu, 0xBBBBBBu, 0x555555u, 0xFFFFFFu,
+	0xC3C3C3u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x2C2C2Cu, 0xDADADAu, 0xFFFFFFu, 0xFFFFFFu, 0x888888u, 0x111111u, 0x999999u, 0xFFFFFFu, 0x909090u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x444444u, 0x444444u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0x111111u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x111111u,
+	0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x0A0A0Au, 0xA1A1A1u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x777777u, 0x333333u, 0xFFFFFFu,
+	0xCCCCCCu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x4C4C4Cu, 0xFFFFFFu, 0xCCCCCCu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x777777u, 0x888888u, 0xFFFFFFu, 0x909090u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u,
+	0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xB2B2B2u, 0xEFEFEFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xDDDDDDu, 0x888888u, 0x888888u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x191919u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu,
+	0xEBEBEBu, 0xFFFFFFu, 0x222222u, 0x222222u, 0xFFFFFFu, 0xFCFCFCu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xB2B2B2u,
+	0xFFFFFFu, 0x777777u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x191919u, 0x565656u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x888888u, 0x222222u, 0xAAAAAAu, 0xFFFFFFu, 0x565656u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x191919u, 0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0xCCCCCCu, 0xFFFFFFu, 0x4C4C4Cu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xA1A1A1u, 0xDEDEDEu, 0xA1A1A1u, 0x0A0A0Au,
+	0x3B3B3Bu, 0x787878u, 0xB2B2B2u, 0xEFEFEFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x111111u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu,
+	0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x6E6E6Eu, 0xFFFFFFu, 0xAAAAAAu, 0x777777u, 0xFFFFFFu, 0xB2B2B2u, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC9C9C9u, 0x3B3B3Bu, 0x191919u, 0x565656u, 0xA1A1A1u, 0xEBEBEBu, 0xFFFFFFu, 0xAAAAAAu,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0xFFFFFFu, 0x666666u, 0x666666u,
+	0xFFFFFFu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xC3C3C3u, 0xFFFFFFu, 0x555555u, 0x111111u, 0xFFFFFFu,
+	0xEFEFEFu, 0x191919u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x222222u, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0x191919u, 0x1B1B1Bu,
+	0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0xFFFFFFu, 0x565656u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x5D5D5Du, 0xFFFFFFu,
+	0xCCCCCCu, 0xBBBBBBu, 0xFFFFFFu, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu,
+	0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xEBEBEBu, 0x909090u, 0x3B3B3Bu,
+	0x1B1B1Bu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xC9C9C9u,
+	0xFFFFFFu, 0x444444u, 0x333333u, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x909090u,
+	0xFFFFFFu, 0x888888u, 0x555555u, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xC3C3C3u, 0x5D5D5Du, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x333333u, 0xAAAAAAu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0x454545u, 0x080808u, 0x3B3B3Bu,
+	0x787878u, 0xC9C9C9u, 0xFFFFFFu, 0xBBBBBBu, 0x222222u, 0xFFFFFFu, 0xDEDEDEu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu,
+	0x7F7F7Fu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0xFFFFFFu,
+	0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0xBBBBBBu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x5D5D5Du, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x5D5D5Du, 0x787878u, 0xFFFFFFu, 0x888888u, 0x333333u, 0x888888u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu,
+	0x111111u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0xC3C3C3u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x909090u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x4C4C4Cu,
+	0xFFFFFFu, 0xCCCCCCu, 0x222222u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x333333u, 0x888888u, 0xFFFFFFu, 0x909090u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u,
+	0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x555555u,
+	0x888888u, 0xBBBBBBu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x888888u, 0x666666u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu,
+	0x3B3B3Bu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0xB2B2B2u,
+	0xFFFFFFu, 0x777777u, 0x777777u, 0xFFFFFFu, 0xA1A1A1u, 0x909090u, 0xFFFFFFu, 0x888888u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0xAAAAAAu, 0xFFFFFFu, 0xB2B2B2u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x191919u, 0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0xCCCCCCu, 0xFFFFFFu, 0x4C4C4Cu, 0x3B3B3Bu, 0xFFFFFFu,
+	0xDDDDDDu, 0xCCCCCCu, 0xFFFFFFu, 0x4C4C4Cu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0xEBEBEBu, 0x1B1B1Bu, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x6E6E6Eu, 0xFFFFFFu, 0xAAAAAAu,
+	0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0x777777u, 0xFFFFFFu, 0xB2B2B2u, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0xAAAAAAu, 0xFFFFFFu, 0xFCFCFCu, 0x2C2C2Cu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu,
+	0xFFFFFFu, 0x232323u, 0xC3C3C3u, 0xFFFFFFu, 0x555555u, 0x888888u, 0xFFFFFFu, 0x909090u, 0x909090u, 0xFFFFFFu, 0x888888u, 0x111111u,
+	0xFFFFFFu, 0xEFEFEFu, 0x191919u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x454545u, 0xFFFFFFu, 0xBBBBBBu, 0x555555u, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0xEBEBEBu, 0x2C2C2Cu,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x3B3B3Bu, 0xFFFFFFu,
+	0xEEEEEEu, 0xDDDDDDu, 0xFFFFFFu, 0x3B3B3Bu, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu, 0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x080808u, 0xDADADAu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x888888u, 0x555555u, 0x666666u, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x555555u, 0xFFFFFFu, 0xABABABu, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x080808u, 0x6E6E6Eu, 0xC3C3C3u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x888888u, 0x888888u, 0x444444u, 0x888888u, 0x888888u, 0xAAAAAAu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC9C9C9u, 0x6E6E6Eu, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0x7F7F7Fu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x6E6E6Eu, 0x3B3B3Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x5D5D5Du, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x5D5D5Du, 0x3B3B3Bu, 0x787878u,
+	0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x909090u, 0x7F7F7Fu, 0xC3C3C3u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x6E6E6Eu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u,
+	0x5D5D5Du, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0x3B3B3Bu, 0x787878u, 0x7F7F7Fu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0x565656u, 0x191919u, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x6E6E6Eu,
+	0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u,
+	0x2C2C2Cu, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDEDEDEu,
+	0xA1A1A1u, 0x787878u, 0x565656u, 0x191919u, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x6E6E6Eu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x5D5D5Du, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xC3C3C3u, 0x6E6E6Eu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0x3B3B3Bu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x6E6E6Eu,
+	0x2A2A2Au, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFCFCFCu, 0x2A2A2Au, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x6E6E6Eu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x222222u, 0x888888u, 0x888888u, 0xAAAAAAu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFCFCFCu, 0xA1A1A1u, 0x2A2A2Au, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xDDDDDDu, 0xFFFFFFu,
+	0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x666666u, 0xFFFFFFu,
+	0xB2B2B2u, 0x4C4C4Cu, 0xFFFFFFu, 0xDDDDDDu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu,
+	0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x555555u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFCFCFCu, 0x7F7F7Fu, 0x232323u, 0xFFFFFFu,
+	0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0x4C4C4Cu, 0xFFFFFFu, 0xDDDDDDu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0xB2B2B2u, 0xFFFFFFu, 0x777777u, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x222222u, 0x999999u,
+	0xFFFFFFu, 0xFFFFFFu, 0xA7A7A7u, 0x0A0A0Au, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu,
+	0x3B3B3Bu, 0xB2B2B2u, 0xFFFFFFu, 0x777777u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu,
+	0xB2B2B2u, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u,
+	0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x444444u, 0xEEEEEEu, 0xFFFFFFu, 0xB8B8B8u, 0x1B1B1Bu, 0x232323u, 0xFFFFFFu,
+	0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0xB2B2B2u, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u, 0xFFFFFFu, 0xFCFCFCu, 0x2A2A2Au, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0xDDDDDDu,
+	0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x222222u,
+	0xDDDDDDu, 0xFFFFFFu, 0xB8B8B8u, 0x0A0A0Au, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u, 0xFFFFFFu, 0xFCFCFCu,
+	0x2A2A2Au, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu,
+	0x909090u, 0x191919u, 0xEBEBEBu, 0xFFFFFFu, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u,
+	0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x111111u, 0xDDDDDDu, 0xFFFFFFu, 0xA7A7A7u, 0x232323u, 0xFFFFFFu, 0xDDDDDDu,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0x909090u, 0x191919u, 0xEBEBEBu, 0xFFFFFFu, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x333333u, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0x7F7F7Fu, 0xFFFFFFu, 0xAAAAAAu, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x222222u, 0xEEEEEEu,
+	0xFFFFFFu, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFCFCFCu, 0x2A2A2Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x333333u, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0x7F7F7Fu, 0xFFFFFFu,
+	0xAAAAAAu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xBBBBBBu, 0xFFFFFFu, 0x6E6E6Eu, 0xC9C9C9u, 0xFFFFFFu,
+	0x444444u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x888888u, 0x888888u, 0x666666u, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xBBBBBBu, 0xFFFFFFu, 0x6E6E6Eu,
+	0xC9C9C9u, 0xFFFFFFu, 0x444444u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x555555u, 0xFFFFFFu, 0xC3C3C3u,
+	0x5D5D5Du, 0xFFFFFFu, 0xCCCCCCu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x888888u, 0xBBBBBBu, 0xFFFFFFu, 0x7F7F7Fu, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u,
+	0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x555555u, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0xFFFFFFu, 0xCCCCCCu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x4C4C4Cu, 0xC3C3C3u, 0xFFFFFFu, 0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x3B3B3Bu, 0x787878u,
+	0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x222222u, 0x444444u, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0x666666u, 0xFFFFFFu, 0x999999u,
+	0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x4C4C4Cu, 0xC3C3C3u, 0xFFFFFFu, 0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x777777u, 0xFFFFFFu, 0xB2B2B2u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x3B3B3Bu,
+	0xC9C9C9u, 0xFFFFFFu, 0xDDDDDDu, 0x111111u, 0xBBBBBBu, 0xFFFFFFu, 0x4C4C4Cu, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x777777u, 0xFFFFFFu, 0xB2B2B2u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0xB2B2B2u, 0xFFFFFFu, 0x888888u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u,
+	0x0A0A0Au, 0xB8B8B8u, 0xFFFFFFu, 0x999999u, 0x777777u, 0xFFFFFFu, 0x909090u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0xB2B2B2u, 0xFFFFFFu, 0x888888u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x666666u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x888888u, 0xFFFFFFu, 0x787878u, 0x2A2A2Au, 0xFCFCFCu, 0xFFFFFFu, 0x222222u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0x666666u, 0xFFFFFFu,
+	0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x666666u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x555555u, 0xDDDDDDu,
+	0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xBBBBBBu, 0x222222u, 0xFFFFFFu, 0xFCFCFCu, 0xFFFFFFu, 0x999999u, 0xBBBBBBu,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x888888u, 0xFFFFFFu, 0x787878u, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0xEEEEEEu, 0xFFFFFFu, 0x121212u, 0x666666u, 0xFFFFFFu, 0x999999u,
+	0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xBBBBBBu, 0x222222u, 0xFFFFFFu, 0xFCFCFCu, 0xFFFFFFu, 0x999999u, 0xBBBBBBu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0x333333u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0x222222u, 0x222222u, 0xFFFFFFu, 0xDDDDDDu,
+	0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u,
+	0xFFFFFFu, 0x787878u, 0x3B3B3Bu, 0xFFFFFFu, 0xCCCCCCu, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u,
+	0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xFFFFFFu, 0x333333u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0x222222u, 0x222222u, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0x999999u, 0x444444u, 0xFFFFFFu, 0xBBBBBBu, 0x888888u, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu,
+	0x787878u, 0x121212u, 0xFFFFFFu, 0xEEEEEEu, 0x999999u, 0xFFFFFFu, 0x666666u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0xFFFFFFu, 0x999999u, 0x444444u, 0xFFFFFFu, 0xBBBBBBu, 0x888888u, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0xBBBBBBu, 0x444444u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u,
+	0xFFFFFFu, 0xFFFFFFu, 0x888888u, 0xFFFFFFu, 0x787878u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xEEEEEEu,
+	0x111111u, 0xBBBBBBu, 0x444444u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0xFFFFFFu, 0xFFFFFFu, 0x777777u, 0x444444u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0xDEDEDEu, 0xFFFFFFu,
+	0x222222u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x777777u,
+	0x444444u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu,
+	0xDDDDDDu, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu,
+	0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0xFFFFFFu, 0xFFFFFFu, 0x888888u, 0xFFFFFFu, 0x787878u,
+	0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu,
+	0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x444444u, 0x444444u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x121212u, 0xFFFFFFu, 0xEEEEEEu, 0x999999u, 0xFFFFFFu, 0x666666u, 0x666666u, 0xFFFFFFu,
+	0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x444444u, 0x444444u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu,
+	0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x999999u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x3B3B3Bu, 0xFFFFFFu, 0xCCCCCCu, 0xBBBBBBu, 0xFFFFFFu,
+	0x454545u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x999999u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xEBEBEBu, 0xFFFFFFu,
+	0x222222u, 0x222222u, 0xFFFFFFu, 0xFCFCFCu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x909090u,
+	0xFFFFFFu, 0x888888u, 0xEEEEEEu, 0xFFFFFFu, 0x121212u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu,
+	0xEBEBEBu, 0xFFFFFFu, 0x222222u, 0x222222u, 0xFFFFFFu, 0xFCFCFCu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0xFFFFFFu,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x888888u, 0xFFFFFFu, 0x787878u, 0x191919u, 0xEBEBEBu, 0xFFFFFFu, 0x333333u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0x666666u, 0xFFFFFFu,
+	0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0xFFFFFFu,
+	0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu,
+	0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u, 0xB8B8B8u, 0xFFFFFFu, 0xAAAAAAu, 0x888888u,
+	0xFFFFFFu, 0x909090u, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xFFFFFFu, 0xEEEEEEu, 0xFFFFFFu,
+	0x121212u, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu,
+	0xFFFFFFu, 0xEEEEEEu, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0xFFFFFFu, 0x666666u, 0x666666u, 0xFFFFFFu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu,
+	0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u,
+	0xFFFFFFu, 0x787878u, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xDDDDDDu, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x3B3B3Bu, 0x666666u, 0xFFFFFFu,
+	0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0xCCCCCCu, 0xFFFFFFu, 0x3B3B3Bu, 0x4C4C4Cu, 0xFFFFFFu,
+	0xBBBBBBu, 0x222222u, 0xFFFFFFu, 0xDEDEDEu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0xFFFFFFu, 0x666666u,
+	0x666666u, 0xFFFFFFu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0x5D5D5Du, 0xFFFFFFu, 0xCCCCCCu, 0xBBBBBBu, 0xFFFFFFu, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0x787878u,
+	0x2A2A2Au, 0x666666u, 0xB2B2B2u, 0xFCFCFCu, 0xFFFFFFu, 0xDDDDDDu, 0x333333u, 0x666666u, 0xFFFFFFu, 0xC3C3C3u, 0x666666u, 0xFFFFFFu,
+	0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0x888888u, 0xFFFFFFu, 0xB2B2B2u, 0xB2B2B2u, 0xFFFFFFu,
+	0x777777u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x5D5D5Du, 0xFFFFFFu, 0xCCCCCCu,
+	0xBBBBBBu, 0xFFFFFFu, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xC9C9C9u, 0xFFFFFFu, 0x444444u, 0x333333u, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x999999u,
+	0xDDDDDDu, 0xFFFFFFu, 0x5D5D5Du, 0x666666u, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0x909090u, 0xFFFFFFu, 0x777777u,
+	0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0xA1A1A1u, 0x3B3B3Bu, 0x3B3B3Bu, 0xB2B2B2u, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x777777u, 0xFFFFFFu,
+	0x898989u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xC9C9C9u, 0xFFFFFFu, 0x444444u, 0x333333u, 0xFFFFFFu, 0xDADADAu,
+	0x080808u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0xFFFFFFu, 0xFFFFFFu,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x999999u,
+	0x888888u, 0x111111u, 0x888888u, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x999999u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x565656u, 0xFFFFFFu, 0xAAAAAAu,
+	0x444444u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x444444u, 0xAAAAAAu,
+	0xFFFFFFu, 0x565656u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu,
+	0x909090u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu,
+	0x787878u, 0xFFFFFFu, 0x888888u, 0x555555u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFCFCFCu, 0x2A2A2Au,
+	0x191919u, 0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0x222222u, 0x888888u, 0xEEEEEEu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0x888888u,
+	0x111111u, 0x222222u, 0xFFFFFFu, 0xEBEBEBu, 0x191919u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0xC3C3C3u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x909090u, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x333333u, 0xEEEEEEu, 0xFFFFFFu, 0x6E6E6Eu, 0x232323u,
+	0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x666666u, 0xB2B2B2u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu,
+	0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x333333u, 0xEEEEEEu, 0xFFFFFFu, 0xA7A7A7u, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0x222222u, 0x333333u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu,
+	0x787878u, 0xFFFFFFu, 0x888888u, 0x555555u, 0xFFFFFFu, 0xFFFFFFu, 0xA7A7A7u, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0xA1A1A1u, 0xFFFFFFu, 0xCCCCCCu, 0x111111u, 0x111111u, 0xDDDDDDu, 0xFFFFFFu, 0x909090u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x333333u, 0xBBBBBBu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x0A0A0Au, 0xC9C9C9u, 0xFFFFFFu, 0xCCCCCCu, 0x111111u, 0x222222u, 0xCCCCCCu, 0xFFFFFFu, 0xB8B8B8u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu,
+	0x787878u, 0xFFFFFFu, 0x888888u, 0x555555u, 0xAAAAAAu, 0xFFFFFFu, 0xFFFFFFu, 0xDADADAu, 0x6E6E6Eu, 0x232323u, 0xFFFFFFu, 0xDDDDDDu,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x1B1B1Bu, 0xC9C9C9u, 0xFFFFFFu, 0xEEEEEEu, 0x555555u, 0x555555u, 0xEEEEEEu, 0xFFFFFFu, 0xC9C9C9u,
+	0x1B1B1Bu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x333333u, 0x888888u, 0x888888u, 0xAAAAAAu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xEBEBEBu, 0x909090u, 0x080808u, 0x232323u, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x666666u, 0x1B1B1Bu, 0xB2B2B2u,
+	0xFFFFFFu, 0xFFFFFFu, 0xBBBBBBu, 0x555555u, 0x555555u, 0xBBBBBBu, 0xFFFFFFu, 0xFFFFFFu, 0xA7A7A7u, 0x0A0A0Au, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x6E6E6Eu, 0x191919u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFCFCFCu, 0x2A2A2Au, 0x6E6E6Eu, 0xDADADAu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x888888u, 0x888888u, 0x555555u, 0x555555u, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDADADAu, 0x6E6E6Eu,
+	0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xC3C3C3u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xC3C3C3u, 0x2C2C2Cu, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xCCCCCCu, 0x909090u, 0x787878u, 0x565656u, 0x191919u, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x080808u, 0x6E6E6Eu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xC3C3C3u, 0x6E6E6Eu, 0x080808u, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x2C2C2Cu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x3B3B3Bu, 0x787878u, 0x787878u, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0x666666u, 0x2A2A2Au, 0x2A2A2Au, 0x666666u, 0x787878u, 0xC3C3C3u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0x787878u, 0x3B3B3Bu, 0x3B3B3Bu,
+	0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x7F7F7Fu,
+	0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xEFEFEFu, 0xB2B2B2u,
+	0x1B1B1Bu, 0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x787878u,
+	0x565656u, 0x191919u, 0x191919u, 0x6E6E6Eu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDEDEDEu, 0xA1A1A1u, 0x3B3B3Bu,
+	0x5D5D5Du, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFCFCFCu, 0x2A2A2Au, 0x7F7F7Fu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xB2B2B2u, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xEFEFEFu, 0xB2B2B2u,
+	0x3B3B3Bu, 0x080808u, 0x909090u, 0xEBEBEBu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x999999u, 0x888888u, 0x777777u, 0x888888u, 0x888888u,
+	0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x191919u, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x111111u,
+	0xEEEEEEu, 0xFFFFFFu, 0x2A2A2Au, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x777777u, 0x888888u, 0xAAAAAAu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x909090u, 0x6E6E6Eu, 0xDADADAu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0x555555u, 0x222222u, 0x888888u, 0xEEEEEEu, 0xFFFFFFu, 0xFFFFFFu,
+	0xEBEBEBu, 0x2C2C2Cu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0x999999u, 0xFFFFFFu, 0x7F7F7Fu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u,
+	0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xC9C9C9u, 0x1B1B1Bu, 0x909090u, 0xFFFFFFu, 0xFFFFFFu, 0xBBBBBBu, 0x333333u, 0x444444u, 0xAAAAAAu,
+	0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0xA1A1A1u, 0xFFFFFFu, 0x888888u, 0x444444u, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x333333u,
+	0xCCCCCCu, 0xFFFFFFu, 0xC9C9C9u, 0x0A0A0Au, 0x0A0A0Au, 0xA7A7A7u, 0xFFFFFFu, 0xFFFFFFu, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u,
+	0x080808u, 0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x3B3B3Bu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x111111u, 0xCCCCCCu,
+	0xFFFFFFu, 0xA7A7A7u, 0xA7A7A7u, 0xFFFFFFu, 0xEEEEEEu, 0x333333u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x5D5D5Du, 0xFFFFFFu, 0xBBBBBBu,
+	0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x222222u, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0x909090u, 0xFFFFFFu,
+	0xEEEEEEu, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u,
+	0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xB2B2B2u, 0xFFFFFFu, 0x666666u, 0x222222u, 0xFFFFFFu, 0xDEDEDEu, 0x080808u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0xB2B2B2u, 0x4C4C4Cu, 0xFFFFFFu, 0xFFFFFFu, 0x333333u, 0xDDDDDDu, 0xFFFFFFu,
+	0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x2A2A2Au, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0xBBBBBBu, 0xFFFFFFu, 0x5D5D5Du, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x888888u, 0x111111u, 0xFFFFFFu, 0xEFEFEFu, 0xC3C3C3u,
+	0xFFFFFFu, 0x777777u, 0x555555u, 0x888888u, 0xEEEEEEu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x888888u, 0x666666u,
+	0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x7F7F7Fu, 0xFFFFFFu, 0x999999u, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x111111u, 0xCCCCCCu,
+	0xFFFFFFu, 0x333333u, 0x6E6E6Eu, 0xFFFFFFu, 0xDDDDDDu, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x888888u, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x2A2A2Au, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x3B3B3Bu, 0xC9C9C9u, 0xFFFFFFu, 0x888888u, 0xAAAAAAu, 0xFFFFFFu, 0x565656u, 0xC3C3C3u,
+	0xFFFFFFu, 0x555555u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0x3B3B3Bu, 0x3B3B3Bu, 0x787878u, 0xC3C3C3u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x999999u, 0x111111u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xFFFFFFu,
+	0xDDDDDDu, 0x444444u, 0x999999u, 0xFFFFFFu, 0x7F7F7Fu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x3B3B3Bu,
+	0xFFFFFFu, 0xCCCCCCu, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0x6E6E6Eu,
+	0x3B3B3Bu, 0xA1A1A1u, 0xFCFCFCu, 0xFFFFFFu, 0xFFFFFFu, 0x666666u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xA1A1A1u, 0xFFFFFFu, 0x888888u,
+	0xDDDDDDu, 0x111111u, 0x444444u, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x232323u,
+	0xFFFFFFu, 0xDDDDDDu, 0xAAAAAAu, 0xFFFFFFu, 0x565656u, 0x909090u, 0xFFFFFFu, 0x888888u, 0x555555u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu,
+	0x2A2A2Au, 0xB2B2B2u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x080808u, 0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0x555555u,
+	0xFFFFFFu, 0x555555u, 0xDDDDDDu, 0xFFFFFFu, 0x3B3B3Bu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x232323u,
+	0xFFFFFFu, 0xDDDDDDu, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0xDDDDDDu, 0xFFFFFFu, 0x6E6E6Eu, 0x5D5D5Du,
+	0xC3C3C3u, 0xFFFFFFu, 0xC3C3C3u, 0x2C2C2Cu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x3B3B3Bu,
+	0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x5D5D5Du, 0xFFFFFFu, 0xBBBBBBu, 0x999999u, 0xFFFFFFu, 0xAAAAAAu,
+	0x888888u, 0xFFFFFFu, 0xA1A1A1u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x7F7F7Fu, 0xFFFFFFu, 0xAAAAAAu,
+	0xEEEEEEu, 0xFFFFFFu, 0x121212u, 0x191919u, 0xFFFFFFu, 0xEEEEEEu, 0x555555u, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u,
+	0xB2B2B2u, 0xFFFFFFu, 0x666666u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0xEEEEEEu, 0x111111u, 0x222222u, 0xFFFFFFu, 0xDEDEDEu, 0x080808u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x3B3B3Bu, 0x909090u, 0xFFFFFFu, 0xFFFFFFu, 0x444444u, 0x444444u,
+	0xFFFFFFu, 0xC3C3C3u, 0x565656u, 0xFFFFFFu, 0xAAAAAAu, 0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u,
+	0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x2A2A2Au, 0xFFFFFFu, 0xEEEEEEu, 0x111111u,
+	0x555555u, 0xFFFFFFu, 0xB2B2B2u, 0xFFFFFFu, 0x666666u, 0xBBBBBBu, 0xFFFFFFu, 0x5D5D5Du, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x777777u, 0x999999u, 0xFFFFFFu, 0x7F7F7Fu,
+	0x787878u, 0xFFFFFFu, 0x888888u, 0xEEEEEEu, 0xFFFFFFu, 0x191919u, 0x7F7F7Fu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u,
+	0x2C2C2Cu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x7F7F7Fu, 0xFFFFFFu, 0x999999u, 0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0xFFFFFFu, 0xAAAAAAu, 0x666666u, 0xFFFFFFu, 0xB2B2B2u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xEEEEEEu, 0x888888u, 0x333333u,
+	0x333333u, 0xFFFFFFu, 0xFCFCFCu, 0x2A2A2Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x111111u, 0xFFFFFFu, 0xEFEFEFu, 0x7F7F7Fu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xDADADAu, 0x080808u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu,
+	0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x111111u, 0xEEEEEEu,
+	0xFFFFFFu, 0x191919u, 0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x191919u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0x909090u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0xBCBCBCu, 0xFFFFFFu,
+	0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0xB2B2B2u, 0xFFFFFFu,
+	0x666666u, 0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x222222u, 0xDDDDDDu, 0xFFFFFFu, 0xB8B8B8u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0xBCBCBCu, 0xFFFFFFu, 0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xA1A1A1u,
+	0xFFFFFFu, 0x888888u, 0xAAAAAAu, 0xFFFFFFu, 0x5D5D5Du, 0x5D5D5Du, 0xFFFFFFu, 0xBBBBBBu, 0x555555u, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x555555u, 0xEEEEEEu, 0xFFFFFFu, 0xB8B8B8u, 0x0A0A0Au, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu,
+	0xBCBCBCu, 0xBCBCBCu, 0xFFFFFFu, 0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu,
+	0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0x111111u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x111111u, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x333333u, 0xAAAAAAu, 0xFFFFFFu, 0xFFFFFFu, 0xA7A7A7u, 0x0A0A0Au, 0x787878u, 0xFFFFFFu, 0x888888u, 0x222222u, 0xFFFFFFu,
+	0xDEDEDEu, 0xBCBCBCu, 0xFFFFFFu, 0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu,
+	0x787878u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x4C4C4Cu, 0xFFFFFFu, 0xCCCCCCu, 0x666666u, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x777777u, 0x888888u, 0xFFFFFFu, 0x909090u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x222222u, 0xEEEEEEu, 0xFFFFFFu, 0x6E6E6Eu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x111111u, 0xFFFFFFu, 0xEFEFEFu, 0xBCBCBCu,
+	0xFFFFFFu, 0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xB2B2B2u, 0xFFFFFFu, 0x777777u, 0x333333u,
+	0xFFFFFFu, 0xCCCCCCu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x555555u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0x565656u, 0xFFFFFFu, 0xAAAAAAu,
+	0xDDDDDDu, 0xFFFFFFu, 0x2A2A2Au, 0xBCBCBCu, 0xFFFFFFu, 0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x3B3B3Bu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x191919u,
+	0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0xCCCCCCu, 0xFFFFFFu, 0x4C4C4Cu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xDDDDDDu, 0x111111u, 0x888888u, 0xFFFFFFu, 0xEBEBEBu, 0x1B1B1Bu, 0x191919u, 0xFFFFFFu, 0xEEEEEEu, 0x999999u, 0xFFFFFFu,
+	0x7F7F7Fu, 0xBCBCBCu, 0xFFFFFFu, 0x444444u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu,
+	0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x6E6E6Eu, 0xFFFFFFu, 0xAAAAAAu, 0x777777u, 0xFFFFFFu,
+	0xB2B2B2u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu, 0xAAAAAAu, 0xFFFFFFu,
+	0xB8B8B8u, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0x444444u, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x222222u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0xC3C3C3u, 0xFFFFFFu, 0x555555u, 0x111111u,
+	0xFFFFFFu, 0xEFEFEFu, 0x191919u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x1B1B1Bu, 0xEBEBEBu, 0xFFFFFFu,
+	0x666666u, 0x111111u, 0xDDDDDDu, 0xFFFFFFu, 0x909090u, 0x909090u, 0xFFFFFFu, 0x777777u, 0xDDDDDDu, 0xFFFFFFu, 0x7F7F7Fu, 0x7F7F7Fu,
+	0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x222222u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0x666666u, 0x3B3B3Bu,
+	0xFFFFFFu, 0xEEEEEEu, 0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x5D5D5Du,
+	0xFFFFFFu, 0xEEEEEEu, 0x222222u, 0x333333u, 0xFFFFFFu, 0xFFFFFFu, 0x4C4C4Cu, 0x4C4C4Cu, 0xFFFFFFu, 0xCCCCCCu, 0x444444u, 0xFFFFFFu,
+	0xFFFFFFu, 0x4C4C4Cu, 0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u,
+	0xFFFFFFu, 0x666666u, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0x909090u,
+	0xFFFFFFu, 0x888888u, 0x555555u, 0xFFFFFFu, 0xC3C3C3u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0xA7A7A7u,
+	0xFFFFFFu, 0xCCCCCCu, 0x777777u, 0xFFFFFFu, 0xEBEBEBu, 0x1B1B1Bu, 0xC9C9C9u, 0xFFFFFFu, 0x444444u, 0x888888u, 0xFFFFFFu, 0xFFFFFFu,
+	0x909090u, 0x080808u, 0xDEDEDEu, 0xFFFFFFu, 0x222222u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0x5D5D5Du, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0xBBBBBBu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0xEEEEEEu, 0xFFFFFFu, 0x3B3B3Bu, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x0A0A0Au, 0xC9C9C9u, 0xFFFFFFu, 0x888888u, 0xAAAAAAu, 0xFFFFFFu, 0xB8B8B8u, 0x7F7F7Fu,
+	0xFFFFFFu, 0xBBBBBBu, 0x777777u, 0xFFFFFFu, 0xFFFFFFu, 0xDEDEDEu, 0xA1A1A1u, 0x666666u, 0x2A2A2Au, 0xDEDEDEu, 0xFFFFFFu, 0x222222u,
+	0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x7F7F7Fu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x9A9A9Au, 0xFFFFFFu, 0xCCCCCCu, 0x222222u, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x333333u,
+	0x888888u, 0xFFFFFFu, 0x909090u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu,
+	0x555555u, 0x111111u, 0xDDDDDDu, 0xFFFFFFu, 0xA7A7A7u, 0x080808u, 0xDADADAu, 0xFFFFFFu, 0x555555u, 0x333333u, 0xBBBBBBu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x222222u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0xB2B2B2u, 0xFFFFFFu,
+	0x777777u, 0x777777u, 0xFFFFFFu, 0xA1A1A1u, 0x909090u, 0xFFFFFFu, 0x888888u, 0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x6E6E6Eu, 0xFFFFFFu, 0xEEEEEEu, 0x222222u, 0x333333u, 0xEEEEEEu, 0xFFFFFFu, 0x6E6E6Eu,
+	0x6E6E6Eu, 0xFFFFFFu, 0xEEEEEEu, 0x222222u, 0x222222u, 0x888888u, 0x999999u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x222222u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu,
+	0x888888u, 0x666666u, 0xFFFFFFu, 0xEFEFEFu, 0xFFFFFFu, 0x111111u, 0xCCCCCCu, 0xFFFFFFu, 0x4C4C4Cu, 0x3B3B3Bu, 0xFFFFFFu, 0xDDDDDDu,
+	0xCCCCCCu, 0xFFFFFFu, 0x4C4C4Cu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0xA7A7A7u, 0xFFFFFFu, 0xCCCCCCu,
+	0x555555u, 0xFFFFFFu, 0xFFFFFFu, 0x3B3B3Bu, 0xA7A7A7u, 0xFFFFFFu, 0xCCCCCCu, 0x111111u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au,
+	0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0xAAAAAAu,
+	0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0xCCCCCCu, 0xFFFFFFu, 0x333333u, 0x777777u, 0xFFFFFFu, 0xB2B2B2u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x888888u, 0xFFFFFFu, 0x787878u, 0x0A0A0Au, 0xC9C9C9u, 0xFFFFFFu, 0x888888u, 0x888888u, 0xFFFFFFu, 0xC9C9C9u, 0x0A0A0Au, 0x0A0A0Au,
+	0xC9C9C9u, 0xFFFFFFu, 0xCCCCCCu, 0x111111u, 0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu,
+	0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0xFFFFFFu, 0x555555u, 0x888888u, 0xFFFFFFu, 0x909090u, 0x909090u,
+	0xFFFFFFu, 0x888888u, 0x111111u, 0xFFFFFFu, 0xEFEFEFu, 0x191919u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u,
+	0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0x555555u, 0xCCCCCCu, 0xFFFFFFu, 0xA7A7A7u, 0x1B1B1Bu, 0xC9C9C9u, 0xFFFFFFu, 0xDDDDDDu, 0x444444u,
+	0xBBBBBBu, 0xFFFFFFu, 0x454545u, 0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u,
+	0x666666u, 0xFFFFFFu, 0xEEEEEEu, 0xDDDDDDu, 0xFFFFFFu, 0x3B3B3Bu, 0x3B3B3Bu, 0xFFFFFFu, 0xEEEEEEu, 0xAAAAAAu, 0xFFFFFFu, 0x6E6E6Eu,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x888888u, 0xFFFFFFu, 0x787878u, 0x6E6E6Eu, 0xFFFFFFu, 0xEEEEEEu, 0x222222u, 0x222222u, 0xEEEEEEu,
+	0xFFFFFFu, 0x7F7F7Fu, 0x1B1B1Bu, 0xB8B8B8u, 0xFFFFFFu, 0xFFFFFFu, 0x999999u, 0x111111u, 0x888888u, 0xDDDDDDu, 0xFFFFFFu, 0x232323u,
+	0x9A9A9Au, 0xFFFFFFu, 0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x787878u, 0xFFFFFFu, 0x888888u, 0x666666u, 0xFFFFFFu, 0x888888u,
+	0x333333u, 0xFFFFFFu, 0xCCCCCCu, 0xC3C3C3u, 0xFFFFFFu, 0x444444u, 0x555555u, 0xFFFFFFu, 0xABABABu, 0x9A9A9Au, 0xFFFFFFu, 0x666666u,
+	0x888888u, 0xFFFFFFu, 0x787878u, 0xA7A7A7u, 0xFFFFFFu, 0xCCCCCCu, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x7F7F7Fu, 0xFCFCFCu, 0xFFFFFFu,
+	0xFFFFFFu, 0x888888u, 0x333333u, 0x444444u, 0x888888u, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xB8B8B8u, 0x9A9A9Au, 0xFFFFFFu,
+	0x666666u, 0x444444u, 0xFFFFFFu, 0xBCBCBCu, 0x3B3B3Bu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x909090u, 0x7F7F7Fu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x6E6E6Eu, 0x5D5D5Du,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0x3B3B3Bu, 0x0A0A0Au, 0xC9C9C9u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0x2A2A2Au, 0xB2B2B2u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x888888u,
+	0x888888u, 0x444444u, 0x555555u, 0x888888u, 0x888888u, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u,
+	0x3B3B3Bu, 0x5D5D5Du, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0x7F7F7Fu, 0x3B3B3Bu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x5D5D5Du, 0xC3C3C3u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xCCCCCCu, 0x909090u, 0x7F7F7Fu, 0xC3C3C3u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x6E6E6Eu, 0x5D5D5Du, 0xC3C3C3u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x3B3B3Bu, 0x2C2C2Cu, 0xC3C3C3u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu,
+	0x3B3B3Bu, 0x909090u, 0xCCCCCCu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xC3C3C3u, 0x7F7F7Fu, 0x3B3B3Bu, 0x5D5D5Du, 0xC3C3C3u,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xC3C3C3u, 0x7F7F7Fu, 0x3B3B3Bu, 0x787878u, 0x7F7F7Fu, 0xC3C3C3u, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu, 0xFFFFFFu,
+	0xFFFFFFu, 0xC3C3C3u, 0x787878u, 0x787878u, 0x3B3B3Bu,
+};
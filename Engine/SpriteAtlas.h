@@ -0,0 +1,51 @@
+#pragma once
+#include "Colors.h"
+
+// Generated by Tools/make_sprite_atlas.py; do not edit.
+// Sprite pixels for SpriteCodex as the opaque runs of each row: a run copies
+// pixels[offset, offset + width) to (x, y) of the sprite, and pixels outside
+// every run are transparent. The full tile sprites have the base colour
+// baked in, so they are one run per row.
+namespace SpriteAtlas
+{
+	struct Span
+	{
+		short x;
+		short y;
+		short width;
+		int offset;
+	};
+	struct Sprite
+	{
+		// subtracted from the draw position; non-zero for center origin sprites
+		short originX;
+		short originY;
+		int firstSpan;
+		int nSpans;
+	};
+	enum SpriteId
+	{
+		Tile0,
+		Tile1,
+		Tile2,
+		Tile3,
+		Tile4,
+		Tile5,
+		Tile6,
+		Tile7,
+		Tile8,
+		Button,
+		Cross,
+		Flag,
+		Bomb,
+		BombRed,
+		Win,
+		Small,
+		Medium,
+		Large,
+		Count
+	};
+	extern const Sprite sprites[Count];
+	extern const Span spans[2730];
+	extern const Color pixels[18113];
+}
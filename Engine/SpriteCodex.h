@@ -3,6 +3,7 @@
 #include "Graphics.h"
 #include "Vei2.h"
 
+// Draws the sprites of SpriteAtlas by copying their opaque row runs
 class SpriteCodex
 {
 public:
@@ -37,4 +38,7 @@ public:
 	static void DrawSmall( const Vei2& pos,Graphics& gfx );
 	static void DrawMedium( const Vei2& pos,Graphics& gfx );
 	static void DrawLarge( const Vei2& pos,Graphics& gfx );
+private:
+	// spriteId is a SpriteAtlas::SpriteId; runs are clipped to the screen
+	static void Draw( int spriteId,const Vei2& pos,Graphics& gfx );
 };
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "Surface.h"
+#include "SpanFill.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+Surface::Surface(int width, int height)
+	:
+	width(width),
+	height(height)
+{
+	assert(width >= 0 && height >= 0);
+	Allocate();
+}
+
+Surface::Surface(const Surface& other)
+	:
+	Surface(other.width, other.height)
+{
+	*this = other;
+}
+
+Surface::Surface(Surface&& other)
+	:
+	width(other.width),
+	height(other.height),
+	pitch(other.pitch),
+	storage(std::move(other.storage)),
+	pPixels(other.pPixels)
+{
+	other.width = 0;
+	other.height = 0;
+	other.pitch = 0;
+	other.pPixels = nullptr;
+}
+
+Surface& Surface::operator=(const Surface& other)
+{
+	if (this == &other) return *this;
+	if (width != other.width || height != other.height)
+	{
+		width = other.width;
+		height = other.height;
+		Allocate();
+	}
+	for (int y = 0; y < height; y++)
+	{
+		std::copy_n(other.GetRow(y), width, GetRow(y));
+	}
+	return *this;
+}
+
+Surface& Surface::operator=(Surface&& other)
+{
+	if (this == &other) return *this;
+	width = other.width;
+	height = other.height;
+	pitch = other.pitch;
+	storage = std::move(other.storage);
+	pPixels = other.pPixels;
+	other.width = 0;
+	other.height = 0;
+	other.pitch = 0;
+	other.pPixels = nullptr;
+	return *this;
+}
+
+int Surface::GetWidth() const
+{
+	return width;
+}
+
+int Surface::GetHeight() const
+{
+	return height;
+}
+
+int Surface::GetPitch() const
+{
+	return pitch;
+}
+
+RectI Surface::GetRect() const
+{
+	return RectI(0, width, 0, height);
+}
+
+void Surface::Fill(Color c)
+{
+	if (height == 0) return;
+	// the padding at the end of each row is filled too, so the whole image is one span
+	SpanFill::Fill(pPixels, pitch * height, c);
+}
+
+void Surface::DrawRect(const RectI& rect, Color c)
+{
+	const RectI clipped = rect.GetClippedTo(GetRect());
+	if (clipped.left >= clipped.right || clipped.top >= clipped.bottom) return;
+	SpanFill::FillRect(pPixels, pitch, clipped.left, clipped.top, clipped.right, clipped.bottom, c);
+}
+
+void Surface::Copy(const Surface& src, const RectI& srcRect, const Vei2& dstPos, const RectI& clip)
+{
+	assert(&src != this);
+	assert(srcRect.IsContainedBy(src.GetRect()));
+	RectI dstRect;
+	Vei2 srcPos;
+	if (!ClipCopy(srcRect, dstPos, clip, dstRect, srcPos)) return;
+	const int rowWidth = dstRect.right - dstRect.left;
+	for (int y = dstRect.top; y < dstRect.bottom; y++)
+	{
+		std::copy_n(src.GetRow(srcPos.y + y - dstRect.top) + srcPos.x, rowWidth, GetRow(y) + dstRect.left);
+	}
+}
+
+void Surface::CopyKeyed(const Surface& src, const RectI& srcRect, const Vei2& dstPos, const RectI& clip, Color key)
+{
+	assert(&src != this);
+	assert(srcRect.IsContainedBy(src.GetRect()));
+	RectI dstRect;
+	Vei2 srcPos;
+	if (!ClipCopy(srcRect, dstPos, clip, dstRect, srcPos)) return;
+	const int rowWidth = dstRect.right - dstRect.left;
+	for (int y = dstRect.top; y < dstRect.bottom; y++)
+	{
+		const Color* const srcRow = src.GetRow(srcPos.y + y - dstRect.top) + srcPos.x;
+		Color* const dstRow = GetRow(y) + dstRect.left;
+		int x = 0;
+		while (x < rowWidth)
+		{
+			while (x < rowWidth && srcRow[x].dword == key.dword) x++;
+			const int runStart = x;
+			while (x < rowWidth && srcRow[x].dword != key.dword) x++;
+			std::copy(srcRow + runStart, srcRow + x, dstRow + runStart);
+		}
+	}
+}
+
+bool Surface::Save(const std::string& path) const
+{
+	std::ofstream file(path, std::ios::binary);
+	if (!file) return false;
+	const bool isPpm = path.size() >= 4 && path.compare(path.size() - 4, 4, ".ppm") == 0;
+	// PPM rows are RGB top down; BMP rows are BGR bottom up, padded to 4 bytes
+	const int rowBytes = isPpm ? 3 * width : (3 * width + 3) / 4 * 4;
+	if (isPpm)
+	{
+		file << "P6\n" << width << ' ' << height << "\n255\n";
+	}
+	else
+	{
+		const uint32_t headerBytes = 14 + 40;
+		const uint32_t imageBytes = uint32_t(rowBytes) * height;
+		unsigned char header[headerBytes] = { 'B','M' };
+		const auto put16 = [&header](int at, uint32_t v)
+		{
+			header[at] = (unsigned char)v;
+			header[at + 1] = (unsigned char)(v >> 8);
+		};
+		const auto put32 = [&put16](int at, uint32_t v)
+		{
+			put16(at, v & 0xFFFF);
+			put16(at + 2, v >> 16);
+		};
+		put32(2, headerBytes + imageBytes);
+		put32(10, headerBytes);
+		put32(14, 40);
+		put32(18, uint32_t(width));
+		put32(22, uint32_t(height));
+		put16(26, 1);
+		put16(28, 24);
+		put32(34, imageBytes);
+		file.write(reinterpret_cast<const char*>(header), headerBytes);
+	}
+	std::vector<unsigned char> row(rowBytes, 0);
+	for (int i = 0; i < height; i++)
+	{
+		const Color* const pixels = GetRow(isPpm ? i : height - 1 - i);
+		for (int x = 0; x < width; x++)
+		{
+			const Color c = pixels[x];
+			row[3 * x] = isPpm ? c.GetR() : c.GetB();
+			row[3 * x + 1] = c.GetG();
+			row[3 * x + 2] = isPpm ? c.GetB() : c.GetR();
+		}
+		file.write(reinterpret_cast<const char*>(row.data()), rowBytes);
+	}
+	return bool(file);
+}
+
+bool Surface::ClipCopy(const RectI& srcRect, const Vei2& dstPos, const RectI& clip, RectI& dstRect, Vei2& srcPos) const
+{
+	dstRect = RectI(dstPos, srcRect.right - srcRect.left, srcRect.bottom - srcRect.top)
+		.GetClippedTo(clip).GetClippedTo(GetRect());
+	if (dstRect.left >= dstRect.right || dstRect.top >= dstRect.bottom) return false;
+	srcPos = { srcRect.left + dstRect.left - dstPos.x,srcRect.top + dstRect.top - dstPos.y };
+	return true;
+}
+
+void Surface::Allocate()
+{
+	// Color is one dword, so rowAlignment / 4 pixels per aligned block
+	const int alignPixels = rowAlignment / int(sizeof(Color));
+	pitch = (width + alignPixels - 1) / alignPixels * alignPixels;
+	// value-initialized (black), with room to slide the start to an aligned address
+	storage.reset(new Color[size_t(pitch) * height + alignPixels]());
+	const uintptr_t address = reinterpret_cast<uintptr_t>(storage.get());
+	pPixels = storage.get() + ((rowAlignment - address % rowAlignment) % rowAlignment) / sizeof(Color);
+}
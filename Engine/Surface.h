@@ -0,0 +1,75 @@
+#pragma once
+#include "Colors.h"
+#include "RectI.h"
+#include "Vei2.h"
+#include <assert.h>
+#include <memory>
+#include <string>
+
+// An owned 32-bit image. Rows start on 32-byte boundaries (the pitch is the
+// width rounded up to 8 pixels), so SpanFill's aligned vector stores cover
+// whole rows. Graphics draws into one; others hold sprites, cached board
+// layers or off-screen frames, and all of them are drawn with the same
+// clipped row-wise copies.
+class Surface
+{
+public:
+	Surface(int width, int height);
+	Surface(const Surface& other);
+	// leaves other empty (0x0)
+	Surface(Surface&& other);
+	Surface& operator=(const Surface& other);
+	Surface& operator=(Surface&& other);
+	int GetWidth() const;
+	int GetHeight() const;
+	// distance between rows, in pixels
+	int GetPitch() const;
+	RectI GetRect() const;
+	Color* GetRow(int y)
+	{
+		assert(y >= 0 && y < height);
+		return pPixels + size_t(pitch) * y;
+	}
+	const Color* GetRow(int y) const
+	{
+		assert(y >= 0 && y < height);
+		return pPixels + size_t(pitch) * y;
+	}
+	void PutPixel(int x, int y, Color c)
+	{
+		assert(x >= 0 && x < width);
+		GetRow(y)[x] = c;
+	}
+	Color GetPixel(int x, int y) const
+	{
+		assert(x >= 0 && x < width);
+		return GetRow(y)[x];
+	}
+	void Fill(Color c);
+	// clipped to the surface
+	void DrawRect(const RectI& rect, Color c);
+	// Copies srcRect of src (another surface) with its top left corner at
+	// dstPos, leaving out whatever falls outside clip or this surface. The
+	// keyed version skips the pixels equal to key and copies the runs
+	// between them.
+	void Copy(const Surface& src, const RectI& srcRect, const Vei2& dstPos, const RectI& clip);
+	void CopyKeyed(const Surface& src, const RectI& srcRect, const Vei2& dstPos, const RectI& clip, Color key);
+	// Writes the image as a binary PPM if path ends in ".ppm", otherwise as a
+	// 24-bit BMP (the X channel is dropped). False if the file could not be
+	// written.
+	bool Save(const std::string& path) const;
+private:
+	// the part of the copy that is drawn, in this surface's coordinates, and
+	// the source pixel that lands on its top left corner; srcRect must lie
+	// inside the source, which the callers assert
+	bool ClipCopy(const RectI& srcRect, const Vei2& dstPos, const RectI& clip, RectI& dstRect, Vei2& srcPos) const;
+	void Allocate();
+private:
+	// rows are aligned to this many bytes
+	static constexpr int rowAlignment = 32;
+	int width;
+	int height;
+	int pitch;
+	std::unique_ptr<Color[]> storage;
+	Color* pPixels = nullptr;
+};
@@ -0,0 +1,18 @@
+#include "TileSet.h"
+
+TileSet::TileSet(int width, int height)
+	:
+	members(width, height),
+	summary((size_t(members.GetWordsPerRow()) * height + 63) / 64, 0u)
+{
+}
+
+size_t TileSet::GetSize() const
+{
+	return size;
+}
+
+size_t TileSet::GetMemoryBytes() const
+{
+	return members.GetMemoryBytes() + summary.capacity() * sizeof(uint64_t);
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include "Vei2.h"
+#include "BitGrid.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A set of board tiles: one bit per tile plus one summary bit per 64-bit word
+// of that plane. Insert, erase and membership are O(1); iteration visits the
+// members in row-major order and skips empty stretches 4096 tiles at a time,
+// so walking a small set on a huge board stays cheap.
+class TileSet
+{
+public:
+	TileSet(int width, int height);
+	bool Contains(const Vei2& gridPos) const
+	{
+		return members.Get(gridPos.x, gridPos.y);
+	}
+	// both are no-ops when the tile already is / is not a member
+	void Insert(const Vei2& gridPos)
+	{
+		if (Contains(gridPos)) return;
+		members.Set(gridPos.x, gridPos.y);
+		const size_t word = GetWordIndex(gridPos);
+		summary[word >> 6] |= uint64_t(1) << (word & 63);
+		size++;
+	}
+	void Erase(const Vei2& gridPos)
+	{
+		if (!Contains(gridPos)) return;
+		members.Clear(gridPos.x, gridPos.y);
+		const size_t word = GetWordIndex(gridPos);
+		if (members.Row(0)[word] == 0)
+		{
+			summary[word >> 6] &= ~(uint64_t(1) << (word & 63));
+		}
+		size--;
+	}
+	// calls f(const Vei2&) for every member; f must not modify the set
+	template<typename F>
+	void ForEach(F&& f) const
+	{
+		ForEachWhile([&](const Vei2& gridPos)
+		{
+			f(gridPos);
+			return true;
+		});
+	}
+	// the same, stopping as soon as f returns false; true if it ran to the end
+	template<typename F>
+	bool ForEachWhile(F&& f) const
+	{
+		const uint64_t* words = members.Row(0);
+		const int wordsPerRow = members.GetWordsPerRow();
+		for (size_t i = 0; i < summary.size(); i++)
+		{
+			for (uint64_t summaryBits = summary[i]; summaryBits != 0; summaryBits &= summaryBits - 1)
+			{
+				const size_t word = i * 64 + BitGrid::CountTrailingZeros(summaryBits);
+				const int y = int(word / wordsPerRow);
+				const int xBase = int(word % wordsPerRow) * 64;
+				for (uint64_t bits = words[word]; bits != 0; bits &= bits - 1)
+				{
+					if (!f(Vei2(xBase + BitGrid::CountTrailingZeros(bits), y))) return false;
+				}
+			}
+		}
+		return true;
+	}
+	// membership bits of one 64-tile word of row y, laid out like BitGrid::Row;
+	// SetWord replaces them wholesale (padding bits must stay zero)
+	uint64_t GetWord(int y, int wordIndex) const
+	{
+		return members.Row(y)[wordIndex];
+	}
+	void SetWord(int y, int wordIndex, uint64_t bits)
+	{
+		uint64_t& word = members.Row(y)[wordIndex];
+		size = size + BitGrid::Popcount(bits) - BitGrid::Popcount(word);
+		word = bits;
+		const size_t index = GetWordIndex({ wordIndex * 64, y });
+		if (bits != 0)
+		{
+			summary[index >> 6] |= uint64_t(1) << (index & 63);
+		}
+		else
+		{
+			summary[index >> 6] &= ~(uint64_t(1) << (index & 63));
+		}
+	}
+	size_t GetSize() const;
+	size_t GetMemoryBytes() const;
+private:
+	size_t GetWordIndex(const Vei2& gridPos) const
+	{
+		return size_t(gridPos.y) * members.GetWordsPerRow() + (gridPos.x >> 6);
+	}
+private:
+	BitGrid members;
+	std::vector<uint64_t> summary;
+	size_t size = 0;
+};
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Generates Engine/SpriteAtlas.h/.cpp from per-pixel sprite drawing code.
+
+The input is the old generated SpriteCodex.cpp, one gfx.PutPixel call per
+pixel (e.g. `git show abea386:Engine/SpriteCodex.cpp > old.cpp`). Every sprite
+becomes a list of opaque runs per row plus their pixels, so SpriteCodex can
+copy whole runs instead of plotting pixels; pixels a sprite never wrote are
+its colour key and simply have no run. The tiles that assume the base colour
+background get it baked in, so each of their rows is a single run.
+
+usage: make_sprite_atlas.py old_SpriteCodex.cpp [output dir]
+"""
+import os
+import re
+import sys
+
+# in SpriteAtlas::SpriteId order
+SPRITES = [
+	('Tile0', 'DrawTile0'),
+	('Tile1', 'DrawTile1'),
+	('Tile2', 'DrawTile2'),
+	('Tile3', 'DrawTile3'),
+	('Tile4', 'DrawTile4'),
+	('Tile5', 'DrawTile5'),
+	('Tile6', 'DrawTile6'),
+	('Tile7', 'DrawTile7'),
+	('Tile8', 'DrawTile8'),
+	('Button', 'DrawTileButton'),
+	('Cross', 'DrawTileCross'),
+	('Flag', 'DrawTileFlag'),
+	('Bomb', 'DrawTileBomb'),
+	('BombRed', 'DrawTileBombRed'),
+	('Win', 'DrawWin'),
+	('Small', 'DrawSmall'),
+	('Medium', 'DrawMedium'),
+	('Large', 'DrawLarge'),
+]
+# sprites drawn over a full tile of SpriteCodex::baseColor
+OPAQUE_TILES = {'Tile0', 'Tile1', 'Tile2', 'Tile3', 'Tile4', 'Tile5', 'Tile6', 'Tile7', 'Tile8', 'Button', 'Bomb',
+	'BombRed'}
+TILE_SIZE = 16
+BASE_COLOR = (192, 192, 192)
+
+FUNCTION_RE = re.compile(r'void\s+SpriteCodex::(\w+)\s*\(')
+ORIGIN_RE = re.compile(r'const\s+int\s+([xy])\s*=\s*pos\.[xy]\s*-\s*([0-9 /*+-]+);')
+PIXEL_RE = re.compile(r'gfx\.PutPixel\(\s*(-?\d+)\s*\+\s*(?:pos\.)?x\s*,\s*(-?\d+)\s*\+\s*(?:pos\.)?y\s*,'
+	r'\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\)')
+
+
+def parse(source):
+	"""Returns {function: (origin, {(x, y): (r, g, b)})}."""
+	functions = {}
+	current = None
+	for line in source.splitlines():
+		match = FUNCTION_RE.search(line)
+		if match:
+			current = {'origin': [0, 0], 'pixels': {}}
+			functions[match.group(1)] = current
+			continue
+		if current is None:
+			continue
+		match = ORIGIN_RE.search(line)
+		if match:
+			# integer division as in C++; the offsets are all positive
+			current['origin']['xy'.index(match.group(1))] = eval(match.group(2).replace('/', '//'))
+			continue
+		match = PIXEL_RE.search(line)
+		if match:
+			x, y, r, g, b = (int(v) for v in match.groups())
+			current['pixels'][(x, y)] = (r, g, b)
+	return functions
+
+
+def build(functions):
+	sprites = []
+	spans = []
+	pixels = []
+	for name, function in SPRITES:
+		origin = functions[function]['origin']
+		image = dict(functions[function]['pixels'])
+		if name in OPAQUE_TILES:
+			for y in range(TILE_SIZE):
+				for x in range(TILE_SIZE):
+					image.setdefault((x, y), BASE_COLOR)
+		firstSpan = len(spans)
+		for y in sorted({y for _, y in image}):
+			row = sorted(x for x, yy in image if yy == y)
+			start = 0
+			while start < len(row):
+				end = start + 1
+				while end < len(row) and row[end] == row[end - 1] + 1:
+					end += 1
+				spans.append((row[start], y, end - start, len(pixels)))
+				pixels.extend(image[(x, y)] for x in row[start:end])
+				start = end
+		sprites.append((name, origin, firstSpan, len(spans) - firstSpan))
+	return sprites, spans, pixels
+
+
+HEADER = """#pragma once
+#include "Colors.h"
+
+// Generated by Tools/make_sprite_atlas.py; do not edit.
+// Sprite pixels for SpriteCodex as the opaque runs of each row: a run copies
+// pixels[offset, offset + width) to (x, y) of the sprite, and pixels outside
+// every run are transparent. The full tile sprites have the base colour
+// baked in, so they are one run per row.
+namespace SpriteAtlas
+{
+	struct Span
+	{
+		short x;
+		short y;
+		short width;
+		int offset;
+	};
+	struct Sprite
+	{
+		// subtracted from the draw position; non-zero for center origin sprites
+		short originX;
+		short originY;
+		int firstSpan;
+		int nSpans;
+	};
+	enum SpriteId
+	{
+%s
+		Count
+	};
+	extern const Sprite sprites[Count];
+	extern const Span spans[%d];
+	extern const Color pixels[%d];
+}
+"""
+
+
+def write(outputDir, sprites, spans, pixels):
+	ids = '\n'.join('\t\t%s,' % name for name, _, _, _ in sprites)
+	with open(os.path.join(outputDir, 'SpriteAtlas.h'), 'w') as f:
+		f.write(HEADER % (ids, len(spans), len(pixels)))
+	lines = ['#include "SpriteAtlas.h"', '', '// Generated by Tools/make_sprite_atlas.py; do not edit.', '',
+		'const SpriteAtlas::Sprite SpriteAtlas::sprites[Count] =', '{']
+	for name, origin, firstSpan, nSpans in sprites:
+		lines.append('\t{ %d,%d,%d,%d },\t// %s' % (origin[0], origin[1], firstSpan, nSpans, name))
+	lines += ['};', '', 'const SpriteAtlas::Span SpriteAtlas::spans[%d] =' % len(spans), '{']
+	for i in range(0, len(spans), 8):
+		lines.append('\t' + ' '.join('{ %d,%d,%d,%d },' % span for span in spans[i:i + 8]))
+	lines += ['};', '', 'const Color SpriteAtlas::pixels[%d] =' % len(pixels), '{']
+	for i in range(0, len(pixels), 12):
+		lines.append('\t' + ' '.join('0x%06Xu,' % ((r << 16) | (g << 8) | b) for r, g, b in pixels[i:i + 12]))
+	lines += ['};', '']
+	with open(os.path.join(outputDir, 'SpriteAtlas.cpp'), 'w') as f:
+		f.write('\n'.join(lines))
+
+
+def main():
+	if len(sys.argv) < 2:
+		sys.exit(__doc__)
+	outputDir = sys.argv[2] if len(sys.argv) > 2 else os.path.join(os.path.dirname(__file__), '..', 'Engine')
+	with open(sys.argv[1]) as f:
+		functions = parse(f.read())
+	sprites, spans, pixels = build(functions)
+	write(outputDir, sprites, spans, pixels)
+	print('%d sprites, %d runs, %d pixels' % (len(sprites), len(spans), len(pixels)))
+
+
+if __name__ == '__main__':
+	main()